@@ -1,11 +1,30 @@
 #include "../src/DataStructure/binary_indexed_tree.hpp"
 #include "../src/DataStructure/binary_indexed_tree_2d.hpp"
+#include "../src/DataStructure/binary_indexed_tree_2d_range.hpp"
+#include "../src/DataStructure/binary_indexed_tree_2d_sparse.hpp"
 #include "../src/DataStructure/binary_indexed_tree_2d_zero.hpp"
+#include "../src/DataStructure/binary_indexed_tree_concurrent.hpp"
+#include "../src/DataStructure/binary_indexed_tree_multi.hpp"
+#include "../src/DataStructure/binary_indexed_tree_range.hpp"
 #include "../src/DataStructure/binary_indexed_tree_zero.hpp"
 #include "../src/DataStructure/binary_trie.hpp"
+#include "../src/DataStructure/bit_multiset.hpp"
+#include "../src/DataStructure/dary_heap.hpp"
+#include "../src/DataStructure/dynamic_lazy_segment_tree.hpp"
+#include "../src/DataStructure/fast_set.hpp"
 #include "../src/DataStructure/heap.hpp"
+#include "../src/DataStructure/indexed_heap.hpp"
 #include "../src/DataStructure/lazy_segment_tree.hpp"
+#include "../src/DataStructure/merge_sort_tree.hpp"
+#include "../src/DataStructure/patricia_trie.hpp"
+#include "../src/DataStructure/persistent_binary_trie.hpp"
+#include "../src/DataStructure/persistent_segment_tree.hpp"
 #include "../src/DataStructure/potentialized_union_find.hpp"
 #include "../src/DataStructure/segment_tree.hpp"
+#include "../src/DataStructure/segment_tree_beats.hpp"
 #include "../src/DataStructure/serial_set.hpp"
+#include "../src/DataStructure/static_lazy_segment_tree.hpp"
+#include "../src/DataStructure/static_segment_tree.hpp"
 #include "../src/DataStructure/union_find.hpp"
+#include "../src/DataStructure/wavelet_matrix.hpp"
+#include "../src/DataStructure/wide_segment_tree.hpp"
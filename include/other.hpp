@@ -1,3 +1,4 @@
 #include "../src/Others/bit_count.hpp"
 #include "../src/Others/convert.hpp"
+#include "../src/Others/parallel_for.hpp"
 #include "../src/Others/table.hpp"
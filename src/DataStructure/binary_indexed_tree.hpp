@@ -53,6 +53,19 @@ public:
         assert(1 <= l and l <= r and r <= sz);
         return sum(r) - sum(l - 1);
     }
+    // sum(r)>=aとなる最小のrを二分探索する．ただし各要素は非負であること．存在しない場合はsz+1を返す．O(logN).
+    int lower_bound(T a) const {
+        if(a <= 0) return 0;
+        int r = 0, step = 1;
+        while(step * 2 <= sz) step <<= 1;
+        for(; step > 0; step >>= 1) {
+            if(r + step <= sz and tree[r + step] < a) {
+                a -= tree[r + step];
+                r += step;
+            }
+        }
+        return r + 1;
+    }
 };
 
 }  // namespace algorithm
@@ -3,35 +3,53 @@
 
 #include <algorithm>  // for copy() and fill().
 #include <cassert>
+#include <tuple>
+#include <utility>  // for pair.
 #include <vector>
 
 namespace algorithm {
 
 // Binary Indexed Tree 2D.
+// 全要素を1つの配列に行優先で格納する．
 template <typename T>
 class BIT2D {
-    int h;                             // h:=(height).
-    int w;                             // w:=(width).
-    std::vector<std::vector<T> > dat;  // 1-based index.
+    int h;                // h:=(height).
+    int w;                // w:=(width).
+    std::vector<T> dat;  // dat[i*(w+1)+j]:=(i行j列目の節点). 1-based index.
 
-    void build() {
-        for(int i = 1; i <= h; ++i)
+    T &at(int i, int j) { return dat[(size_t)i * (w + 1) + j]; }
+    const T &at(int i, int j) const { return dat[(size_t)i * (w + 1) + j]; }
+    // 各要素の値が格納された配列a[]を，BITの節点の値に変換する．O(H*W).
+    void build(std::vector<T> &a) const {
+        const size_t s = w + 1;
+        for(int i = 1; i <= h; ++i) {
+            const int ni = i + (i & -i);
             for(int j = 1; j <= w; ++j) {
-                int ni = i + (i & -i), nj = j + (j & -j);
+                const int nj = j + (j & -j);
                 bool flag1 = (ni <= h), flag2 = (nj <= w);
-                if(flag1) dat[ni][j] += dat[i][j];
-                if(flag2) dat[i][nj] += dat[i][j];
-                if(flag1 and flag2) dat[ni][nj] -= dat[i][j];
+                const T v = a[i * s + j];
+                if(flag1) a[ni * s + j] += v;
+                if(flag2) a[i * s + nj] += v;
+                if(flag1 and flag2) a[ni * s + nj] -= v;
             }
+        }
+    }
+    void build() { build(dat); }
+    // q回の操作を個別に行うよりも，全体を線形時間で処理する方が速いか判定する．
+    bool prefer_linear(size_t q) const {
+        int lh = 1, lw = 1;
+        while((1 << lh) <= h) lh++;
+        while((1 << lw) <= w) lw++;
+        return (double)q * lh * lw >= (double)(h + 1) * (w + 1);
     }
 
 public:
     // constructor. O(H*W).
     BIT2D() : BIT2D(0, 0) {}
-    explicit BIT2D(size_t h_, size_t w_) : h(h_), w(w_), dat(h_ + 1, std::vector<T>(w_ + 1, 0)) {}
+    explicit BIT2D(size_t h_, size_t w_) : h(h_), w(w_), dat((h_ + 1) * (w_ + 1), 0) {}
     explicit BIT2D(const std::vector<std::vector<T> > &dat_)
-        : h(dat_.size()), w(dat_[0].size()), dat(dat_.size() + 1, std::vector<T>(dat_[0].size() + 1)) {
-        for(int i = 0; i < h; ++i) std::copy(dat_[i].begin(), dat_[i].end(), dat[i + 1].begin() + 1);
+        : h(dat_.size()), w(dat_[0].size()), dat((dat_.size() + 1) * (dat_[0].size() + 1), 0) {
+        for(int i = 0; i < h; ++i) std::copy(dat_[i].begin(), dat_[i].end(), dat.begin() + (size_t)(i + 1) * (w + 1) + 1);
         build();
     }
 
@@ -39,24 +57,45 @@ public:
     int width() const { return w; }
     // 全要素をaで埋める．O(H*W).
     void fill(T a = 0) {
-        for(int i = 1; i <= h; ++i) std::fill(dat[i].begin() + 1, dat[i].end(), a);
+        std::fill(dat.begin(), dat.end(), 0);
         if(a == 0) return;
+        for(int i = 1; i <= h; ++i) std::fill(dat.begin() + (size_t)i * (w + 1) + 1, dat.begin() + (size_t)(i + 1) * (w + 1), a);
         build();
     }
     // 座標(x,y)にaを加算する．O((logH)*logW).
     void add(int y, int x, T a) {
         assert(1 <= y and y <= h);
         assert(1 <= x and x <= w);
-        for(int i = y; i <= h; i += (i & -i))
-            for(int j = x; j <= w; j += (j & -j)) dat[i][j] += a;
+        for(int i = y; i <= h; i += (i & -i)) {
+            T *row = &at(i, 0);
+            for(int j = x; j <= w; j += (j & -j)) row[j] += a;
+        }
+    }
+    // 複数の加算をまとめて行う．updates[i]=(y,x,a). O(min(H*W+Q,Q*(logH)*logW)).
+    // 加算の回数が多い場合，加算量を並べた配列を線形時間でBITに変換してから足し合わせる．
+    void add_batch(const std::vector<std::tuple<int, int, T> > &updates) {
+        if(!prefer_linear(updates.size())) {
+            for(const auto &[y, x, a] : updates) add(y, x, a);
+            return;
+        }
+        std::vector<T> tmp(dat.size(), 0);
+        for(const auto &[y, x, a] : updates) {
+            assert(1 <= y and y <= h);
+            assert(1 <= x and x <= w);
+            tmp[(size_t)y * (w + 1) + x] += a;
+        }
+        build(tmp);
+        for(size_t i = 0; i < dat.size(); ++i) dat[i] += tmp[i];
     }
     // 区間[1,y]かつ[1,x]の総和を求める．O((logH)*logW).
     T sum(int y, int x) const {
         assert(0 <= y and y <= h);
         assert(0 <= x and x <= w);
         T res = 0;
-        for(int i = y; i > 0; i -= (i & -i))
-            for(int j = x; j > 0; j -= (j & -j)) res += dat[i][j];
+        for(int i = y; i > 0; i -= (i & -i)) {
+            const T *row = &at(i, 0);
+            for(int j = x; j > 0; j -= (j & -j)) res += row[j];
+        }
         return res;
     }
     // 区間[y,yy]かつ[x,xx]の総和を求める．
@@ -65,6 +104,40 @@ public:
         assert(1 <= x and x <= xx and xx <= w);
         return sum(yy, xx) - sum(yy, x - 1) - sum(y - 1, xx) + sum(y - 1, x - 1);
     }
+    // 複数の区間[1,y]かつ[1,x]の総和をまとめて求める．res[i]:=sum(queries[i].first, queries[i].second). O(min(H*W+Q,Q*(logH)*logW)).
+    // 取得の回数が多い場合，全ての累積和を線形時間で復元してから答える．
+    std::vector<T> sum_batch(const std::vector<std::pair<int, int> > &queries) const {
+        const int q = queries.size();
+        std::vector<T> res(q);
+        if(!prefer_linear(q)) {
+            for(int i = 0; i < q; ++i) res[i] = sum(queries[i].first, queries[i].second);
+            return res;
+        }
+        // build()の逆順に処理して各要素の値を復元し，2次元累積和をとる．
+        const size_t s = w + 1;
+        std::vector<T> a = dat;
+        for(int i = h; i >= 1; --i) {
+            const int ni = i + (i & -i);
+            for(int j = w; j >= 1; --j) {
+                const int nj = j + (j & -j);
+                bool flag1 = (ni <= h), flag2 = (nj <= w);
+                const T v = a[i * s + j];
+                if(flag1) a[ni * s + j] -= v;
+                if(flag2) a[i * s + nj] -= v;
+                if(flag1 and flag2) a[ni * s + nj] += v;
+            }
+        }
+        for(int i = 1; i <= h; ++i) {
+            for(int j = 1; j <= w; ++j) a[i * s + j] += a[(i - 1) * s + j] + a[i * s + j - 1] - a[(i - 1) * s + j - 1];
+        }
+        for(int i = 0; i < q; ++i) {
+            const auto &[y, x] = queries[i];
+            assert(0 <= y and y <= h);
+            assert(0 <= x and x <= w);
+            res[i] = a[y * s + x];
+        }
+        return res;
+    }
 };
 
 }  // namespace algorithm
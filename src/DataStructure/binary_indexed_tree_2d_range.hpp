@@ -0,0 +1,82 @@
+#ifndef ALGORITHM_BINARY_INDEXED_TREE_2D_RANGE_HPP
+#define ALGORITHM_BINARY_INDEXED_TREE_2D_RANGE_HPP 1
+
+#include <cassert>
+#include <vector>
+
+#include "binary_indexed_tree_2d.hpp"
+
+namespace algorithm {
+
+// 矩形加算・矩形和取得のBinary Indexed Tree 2D.
+// 2次元差分d[][]を用いて，prefix sum(y,x)=yxΣd-xΣd(i-1)-yΣd(j-1)+Σd(i-1)(j-1) と表し，4つのBIT2Dで管理する．
+template <typename T>
+class RangeBIT2D {
+    int h;          // h:=(height).
+    int w;          // w:=(width).
+    BIT2D<T> b[4];  // b[0][i][j]:=d[i][j], b[1]:=d*(i-1), b[2]:=d*(j-1), b[3]:=d*(i-1)*(j-1).
+
+    void add0(int y, int x, T a) {
+        if(y > h or x > w) return;
+        b[0].add(y, x, a);
+        b[1].add(y, x, a * (y - 1));
+        b[2].add(y, x, a * (x - 1));
+        b[3].add(y, x, a * (y - 1) * (x - 1));
+    }
+
+public:
+    // constructor. O(H*W).
+    RangeBIT2D() : RangeBIT2D(0, 0) {}
+    explicit RangeBIT2D(size_t h_, size_t w_) : h(h_), w(w_) {
+        for(int t = 0; t < 4; ++t) b[t] = BIT2D<T>(h, w);
+    }
+    explicit RangeBIT2D(const std::vector<std::vector<T> > &dat_) : h(dat_.size()), w(dat_[0].size()) {
+        std::vector<std::vector<T> > d[4];
+        for(int t = 0; t < 4; ++t) d[t].assign(h, std::vector<T>(w));
+        for(int i = 0; i < h; ++i) {
+            for(int j = 0; j < w; ++j) {
+                T a = dat_[i][j];
+                if(i > 0) a -= dat_[i - 1][j];
+                if(j > 0) a -= dat_[i][j - 1];
+                if(i > 0 and j > 0) a += dat_[i - 1][j - 1];
+                d[0][i][j] = a, d[1][i][j] = a * i, d[2][i][j] = a * j, d[3][i][j] = a * i * j;
+            }
+        }
+        for(int t = 0; t < 4; ++t) b[t] = BIT2D<T>(d[t]);
+    }
+
+    int height() const { return h; }
+    int width() const { return w; }
+    // 全要素をaで埋める．O(H*W).
+    void fill(T a = 0) {
+        for(int t = 0; t < 4; ++t) b[t].fill(0);
+        if(h > 0 and w > 0) add(1, 1, h, w, a);
+    }
+    // 座標(x,y)にaを加算する．O((logH)*logW).
+    void add(int y, int x, T a) { add(y, x, y, x, a); }
+    // 区間[y,yy]かつ[x,xx]の各要素にaを加算する．O((logH)*logW).
+    void add(int y, int x, int yy, int xx, T a) {
+        assert(1 <= y and y <= yy and yy <= h);
+        assert(1 <= x and x <= xx and xx <= w);
+        add0(y, x, a);
+        add0(y, xx + 1, -a);
+        add0(yy + 1, x, -a);
+        add0(yy + 1, xx + 1, a);
+    }
+    // 区間[1,y]かつ[1,x]の総和を求める．O((logH)*logW).
+    T sum(int y, int x) const {
+        assert(0 <= y and y <= h);
+        assert(0 <= x and x <= w);
+        return b[0].sum(y, x) * y * x - b[1].sum(y, x) * x - b[2].sum(y, x) * y + b[3].sum(y, x);
+    }
+    // 区間[y,yy]かつ[x,xx]の総和を求める．O((logH)*logW).
+    T sum(int y, int x, int yy, int xx) const {
+        assert(1 <= y and y <= yy and yy <= h);
+        assert(1 <= x and x <= xx and xx <= w);
+        return sum(yy, xx) - sum(yy, x - 1) - sum(y - 1, xx) + sum(y - 1, x - 1);
+    }
+};
+
+}  // namespace algorithm
+
+#endif
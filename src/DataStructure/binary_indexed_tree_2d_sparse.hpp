@@ -0,0 +1,82 @@
+#ifndef ALGORITHM_BINARY_INDEXED_TREE_2D_SPARSE_HPP
+#define ALGORITHM_BINARY_INDEXED_TREE_2D_SPARSE_HPP 1
+
+#include <algorithm>  // for lower_bound(), sort() and unique().
+#include <cassert>
+#include <utility>  // for pair.
+#include <vector>
+
+namespace algorithm {
+
+// 疎な2次元Binary Indexed Tree (オフライン)．
+// 加算を行う座標の集合を予め受け取り，y方向のBITの各節点には，その節点に加算されうるx座標のみを整列して保持する．
+// 座標の範囲によらず，メモリ使用量はO(NlogN)となる (N:=座標の数)．
+template <typename T, typename Coord = long long>
+class SparseBIT2D {
+    int n;                 // n:=(y座標の種類数).
+    std::vector<Coord> ys;  // ys[]:=(y座標の候補). 昇順．
+    std::vector<int> ofs;   // ofs[i]:=(節点iが担当するx座標の先頭位置). 節点iのx座標はxs[ofs[i]:ofs[i+1]].
+    std::vector<Coord> xs;  // xs[]:=(各節点が担当するx座標を連結したもの). 節点ごとに昇順．
+    std::vector<T> dat;     // dat[ofs[i]+j-1]:=(節点iの内側のBITのj番目の節点). 1-based index.
+
+    // 節点iのx座標のうち，x未満のものの個数を返す．
+    int count_less(int i, const Coord &x) const {
+        return std::lower_bound(xs.begin() + ofs[i], xs.begin() + ofs[i + 1], x) - (xs.begin() + ofs[i]);
+    }
+
+public:
+    // constructor. 加算を行う座標(y,x)の集合pointsを受け取る．O(NlogN).
+    SparseBIT2D() : SparseBIT2D(std::vector<std::pair<Coord, Coord> >()) {}
+    explicit SparseBIT2D(std::vector<std::pair<Coord, Coord> > points) {
+        std::sort(points.begin(), points.end());
+        points.erase(std::unique(points.begin(), points.end()), points.end());
+        for(const auto &[y, _] : points) {
+            if(ys.empty() or ys.back() != y) ys.push_back(y);
+        }
+        n = ys.size();
+        std::vector<std::vector<Coord> > cand(n + 1);
+        for(const auto &[y, x] : points) {
+            int k = std::lower_bound(ys.begin(), ys.end(), y) - ys.begin() + 1;
+            for(int i = k; i <= n; i += (i & -i)) cand[i].push_back(x);
+        }
+        ofs.assign(n + 2, 0);
+        for(int i = 1; i <= n; ++i) {
+            std::sort(cand[i].begin(), cand[i].end());
+            cand[i].erase(std::unique(cand[i].begin(), cand[i].end()), cand[i].end());
+            ofs[i + 1] = ofs[i] + cand[i].size();
+        }
+        xs.reserve(ofs[n + 1]);
+        for(int i = 1; i <= n; ++i) xs.insert(xs.end(), cand[i].begin(), cand[i].end());
+        dat.assign(ofs[n + 1], 0);
+    }
+
+    // 座標(y,x)にaを加算する．ただし(y,x)は構築時に与えた座標であること．O((logN)^2).
+    void add(const Coord &y, const Coord &x, T a) {
+        int k = std::lower_bound(ys.begin(), ys.end(), y) - ys.begin();
+        assert(k < n and ys[k] == y);
+        for(int i = k + 1; i <= n; i += (i & -i)) {
+            int j = count_less(i, x);
+            const int m = ofs[i + 1] - ofs[i];
+            assert(j < m and xs[ofs[i] + j] == x);
+            for(j = j + 1; j <= m; j += (j & -j)) dat[ofs[i] + j - 1] += a;
+        }
+    }
+    // y座標がy未満かつx座標がx未満である点の総和を求める．O((logN)^2).
+    T sum(const Coord &y, const Coord &x) const {
+        T res = 0;
+        int k = std::lower_bound(ys.begin(), ys.end(), y) - ys.begin();
+        for(int i = k; i > 0; i -= (i & -i)) {
+            for(int j = count_less(i, x); j > 0; j -= (j & -j)) res += dat[ofs[i] + j - 1];
+        }
+        return res;
+    }
+    // 区間[y,yy)かつ[x,xx)に含まれる点の総和を求める．O((logN)^2).
+    T sum(const Coord &y, const Coord &x, const Coord &yy, const Coord &xx) const {
+        assert(!(yy < y) and !(xx < x));
+        return sum(yy, xx) - sum(yy, x) - sum(y, xx) + sum(y, x);
+    }
+};
+
+}  // namespace algorithm
+
+#endif
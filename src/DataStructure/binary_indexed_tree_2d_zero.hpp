@@ -1,35 +1,54 @@
 #ifndef ALGORITHM_BINARY_INDEXED_TREE_2D_ZERO_HPP
 #define ALGORITHM_BINARY_INDEXED_TREE_2D_ZERO_HPP 1
 
-#include <algorithm>  // for fill().
+#include <algorithm>  // for copy() and fill().
 #include <cassert>
+#include <tuple>
+#include <utility>  // for pair.
 #include <vector>
 
 namespace algorithm {
 
 // Binary Indexed Tree 2D (0-based index).
+// 全要素を1つの配列に行優先で格納する．
 template <typename T>
 class BIT2D0 {
-    int h;                             // h:=(height).
-    int w;                             // w:=(width).
-    std::vector<std::vector<T> > dat;  // 0-based index.
+    int h;               // h:=(height).
+    int w;               // w:=(width).
+    std::vector<T> dat;  // dat[i*w+j]:=(i行j列目の節点). 0-based index.
 
-    void build() {
-        for(int i = 0; i < h; ++i)
+    T &at(int i, int j) { return dat[(size_t)i * w + j]; }
+    const T &at(int i, int j) const { return dat[(size_t)i * w + j]; }
+    // 各要素の値が格納された配列a[]を，BITの節点の値に変換する．O(H*W).
+    void build(std::vector<T> &a) const {
+        const size_t s = w;
+        for(int i = 0; i < h; ++i) {
+            const int ni = i | (i + 1);
             for(int j = 0; j < w; ++j) {
-                int ni = i | (i + 1), nj = j | (j + 1);
+                const int nj = j | (j + 1);
                 bool flag1 = (ni < h), flag2 = (nj < w);
-                if(flag1) dat[ni][j] += dat[i][j];
-                if(flag2) dat[i][nj] += dat[i][j];
-                if(flag1 and flag2) dat[ni][nj] -= dat[i][j];
+                const T v = a[i * s + j];
+                if(flag1) a[ni * s + j] += v;
+                if(flag2) a[i * s + nj] += v;
+                if(flag1 and flag2) a[ni * s + nj] -= v;
             }
+        }
+    }
+    void build() { build(dat); }
+    // q回の操作を個別に行うよりも，全体を線形時間で処理する方が速いか判定する．
+    bool prefer_linear(size_t q) const {
+        int lh = 1, lw = 1;
+        while((1 << lh) <= h) lh++;
+        while((1 << lw) <= w) lw++;
+        return (double)q * lh * lw >= (double)h * w;
     }
 
 public:
     // constructor. O(H*W).
     BIT2D0() : BIT2D0(0, 0) {}
-    explicit BIT2D0(size_t h_, size_t w_) : h(h_), w(w_), dat(h_, std::vector<T>(w_, 0)) {}
-    explicit BIT2D0(const std::vector<std::vector<T> > &dat_) : h(dat_.size()), w(dat_[0].size()), dat(dat_) {
+    explicit BIT2D0(size_t h_, size_t w_) : h(h_), w(w_), dat(h_ * w_, 0) {}
+    explicit BIT2D0(const std::vector<std::vector<T> > &dat_) : h(dat_.size()), w(dat_[0].size()), dat(dat_.size() * dat_[0].size()) {
+        for(int i = 0; i < h; ++i) std::copy(dat_[i].begin(), dat_[i].end(), dat.begin() + (size_t)i * w);
         build();
     }
 
@@ -37,7 +56,7 @@ public:
     int width() const { return w; }
     // 全要素をaで埋める．O(H*W).
     void fill(T a = 0) {
-        for(int i = 0; i < h; ++i) std::fill(dat[i].begin(), dat[i].end(), a);
+        std::fill(dat.begin(), dat.end(), a);
         if(a == 0) return;
         build();
     }
@@ -45,16 +64,36 @@ public:
     void add(int y, int x, T a) {
         assert(0 <= y and y < h);
         assert(0 <= x and x < w);
-        for(int i = y; i < h; i |= i + 1)
-            for(int j = x; j < w; j |= j + 1) dat[i][j] += a;
+        for(int i = y; i < h; i |= i + 1) {
+            T *row = &at(i, 0);
+            for(int j = x; j < w; j |= j + 1) row[j] += a;
+        }
+    }
+    // 複数の加算をまとめて行う．updates[i]=(y,x,a). O(min(H*W+Q,Q*(logH)*logW)).
+    // 加算の回数が多い場合，加算量を並べた配列を線形時間でBITに変換してから足し合わせる．
+    void add_batch(const std::vector<std::tuple<int, int, T> > &updates) {
+        if(!prefer_linear(updates.size())) {
+            for(const auto &[y, x, a] : updates) add(y, x, a);
+            return;
+        }
+        std::vector<T> tmp(dat.size(), 0);
+        for(const auto &[y, x, a] : updates) {
+            assert(0 <= y and y < h);
+            assert(0 <= x and x < w);
+            tmp[(size_t)y * w + x] += a;
+        }
+        build(tmp);
+        for(size_t i = 0; i < dat.size(); ++i) dat[i] += tmp[i];
     }
     // 区間[0,y)かつ[0,x)の総和を求める．O((logH)*logW).
     T sum(int y, int x) const {
         assert(0 <= y and y <= h);
         assert(0 <= x and x <= w);
         T res = 0;
-        for(int i = y - 1; i >= 0; i = (i & (i + 1)) - 1)
-            for(int j = x - 1; j >= 0; j = (j & (j + 1)) - 1) res += dat[i][j];
+        for(int i = y - 1; i >= 0; i = (i & (i + 1)) - 1) {
+            const T *row = &at(i, 0);
+            for(int j = x - 1; j >= 0; j = (j & (j + 1)) - 1) res += row[j];
+        }
         return res;
     }
     // 区間[y,yy)かつ[x,xx)の総和を求める．
@@ -63,6 +102,42 @@ public:
         assert(0 <= x and x <= xx and xx <= w);
         return sum(yy, xx) - sum(yy, x) - sum(y, xx) + sum(y, x);
     }
+    // 複数の区間[0,y)かつ[0,x)の総和をまとめて求める．res[i]:=sum(queries[i].first, queries[i].second). O(min(H*W+Q,Q*(logH)*logW)).
+    // 取得の回数が多い場合，全ての累積和を線形時間で復元してから答える．
+    std::vector<T> sum_batch(const std::vector<std::pair<int, int> > &queries) const {
+        const int q = queries.size();
+        std::vector<T> res(q);
+        if(!prefer_linear(q)) {
+            for(int i = 0; i < q; ++i) res[i] = sum(queries[i].first, queries[i].second);
+            return res;
+        }
+        // build()の逆順に処理して各要素の値を復元し，2次元累積和をとる．acc[(i+1)*(w+1)+(j+1)]:=sum(i+1,j+1).
+        const size_t s = w;
+        std::vector<T> a = dat;
+        for(int i = h - 1; i >= 0; --i) {
+            const int ni = i | (i + 1);
+            for(int j = w - 1; j >= 0; --j) {
+                const int nj = j | (j + 1);
+                bool flag1 = (ni < h), flag2 = (nj < w);
+                const T v = a[i * s + j];
+                if(flag1) a[ni * s + j] -= v;
+                if(flag2) a[i * s + nj] -= v;
+                if(flag1 and flag2) a[ni * s + nj] += v;
+            }
+        }
+        const size_t s2 = w + 1;
+        std::vector<T> acc((size_t)(h + 1) * (w + 1), 0);
+        for(int i = 0; i < h; ++i) {
+            for(int j = 0; j < w; ++j) acc[(i + 1) * s2 + j + 1] = a[i * s + j] + acc[i * s2 + j + 1] + acc[(i + 1) * s2 + j] - acc[i * s2 + j];
+        }
+        for(int i = 0; i < q; ++i) {
+            const auto &[y, x] = queries[i];
+            assert(0 <= y and y <= h);
+            assert(0 <= x and x <= w);
+            res[i] = acc[y * s2 + x];
+        }
+        return res;
+    }
 };
 
 }  // namespace algorithm
@@ -0,0 +1,65 @@
+#ifndef ALGORITHM_BINARY_INDEXED_TREE_CONCURRENT_HPP
+#define ALGORITHM_BINARY_INDEXED_TREE_CONCURRENT_HPP 1
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>  // for size_t.
+#include <type_traits>
+#include <vector>
+
+namespace algorithm {
+
+// 複数のスレッドから同時に操作できるBinary Indexed Tree.
+// 各節点を原子的変数とし，add()はロックを用いずにfetch_add()で更新する．
+// sum()は各節点を原子的に読み出すため，並行するadd()は節点単位で反映される (全体として一貫したスナップショットではない)．
+// 更新が止まっている間のsum()は，BITと同じ値を返す．
+template <typename T>
+class ConcurrentBIT {
+    static_assert(std::is_integral<T>::value, "T must be an integral type");
+
+    int sz;                             // sz:=(要素数).
+    std::vector<std::atomic<T> > tree;  // 1-based index.
+
+public:
+    // constructor. O(N).
+    ConcurrentBIT() : ConcurrentBIT(0) {}
+    explicit ConcurrentBIT(size_t sz_) : sz(sz_), tree(sz_ + 1) {
+        for(auto &elem : tree) elem.store(0, std::memory_order_relaxed);
+    }
+    explicit ConcurrentBIT(const std::vector<T> &v) : sz(v.size()), tree(v.size() + 1) {
+        std::vector<T> tmp(sz + 1, 0);
+        for(int i = 1; i <= sz; ++i) tmp[i] = v[i - 1];
+        for(int i = 1; i < sz; ++i) {
+            int j = i + (i & -i);
+            if(j <= sz) tmp[j] += tmp[i];
+        }
+        for(int i = 0; i <= sz; ++i) tree[i].store(tmp[i], std::memory_order_relaxed);
+    }
+
+    int size() const { return sz; }
+    // 全要素を0にする．他のスレッドが操作していない間に呼び出すこと．O(N).
+    void reset() {
+        for(auto &elem : tree) elem.store(0, std::memory_order_relaxed);
+    }
+    // k番目の要素にaを足す．任意のスレッドから同時に呼び出せる．O(logN).
+    void add(int k, T a) {
+        assert(1 <= k and k <= sz);
+        for(; k <= sz; k += (k & -k)) tree[k].fetch_add(a, std::memory_order_relaxed);
+    }
+    // 区間[1,r]の総和を求める．任意のスレッドから同時に呼び出せる．O(logN).
+    T sum(int r) const {
+        assert(0 <= r and r <= sz);
+        T res = 0;
+        for(; r > 0; r -= (r & -r)) res += tree[r].load(std::memory_order_relaxed);
+        return res;
+    }
+    // 区間[l,r]の総和を求める．O(logN).
+    T sum(int l, int r) const {
+        assert(1 <= l and l <= r and r <= sz);
+        return sum(r) - sum(l - 1);
+    }
+};
+
+}  // namespace algorithm
+
+#endif
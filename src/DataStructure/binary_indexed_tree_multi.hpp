@@ -0,0 +1,91 @@
+#ifndef ALGORITHM_BINARY_INDEXED_TREE_MULTI_HPP
+#define ALGORITHM_BINARY_INDEXED_TREE_MULTI_HPP 1
+
+#include <algorithm>  // for copy() and fill().
+#include <array>
+#include <cassert>
+#include <cstddef>  // for size_t.
+#include <vector>
+
+namespace algorithm {
+
+// 同じ添字集合上のK個のBinary Indexed Treeを1つにまとめたもの．
+// 各節点のK個の値を隣り合わせに格納し (節点ごとのAoS，インターリーブ配置)，1回の走査でK個の値をまとめて更新・取得する．
+// 節点内の演算は固定長のループであり，コンパイラによりSIMD命令へ自動ベクトル化される．
+template <typename T, int K>
+class MultiBIT {
+    static_assert(K >= 1);
+
+public:
+    using value_type = std::array<T, K>;
+
+private:
+    int sz;               // sz:=(要素数).
+    std::vector<T> tree;  // tree[k*K+c]:=(c番目のBITの節点k). 1-based index.
+
+    T *cell(int k) { return tree.data() + (size_t)k * K; }
+    const T *cell(int k) const { return tree.data() + (size_t)k * K; }
+    void build() {
+        for(int i = 1; i < sz; ++i) {
+            int j = i + (i & -i);
+            if(j > sz) continue;
+            T *dst = cell(j);
+            const T *src = cell(i);
+            for(int c = 0; c < K; ++c) dst[c] += src[c];
+        }
+    }
+
+public:
+    // constructor. O(N*K).
+    MultiBIT() : MultiBIT(0) {}
+    explicit MultiBIT(size_t sz_) : sz(sz_), tree((sz_ + 1) * K, 0) {}
+    explicit MultiBIT(const std::vector<value_type> &v) : sz(v.size()), tree((v.size() + 1) * K) {
+        for(int i = 0; i < sz; ++i) std::copy(v[i].begin(), v[i].end(), cell(i + 1));
+        build();
+    }
+
+    int size() const { return sz; }
+    // 全要素をaで埋める．O(N*K).
+    void fill(const value_type &a = value_type()) {
+        std::fill(tree.begin(), tree.end(), 0);
+        for(int i = 1; i <= sz; ++i) std::copy(a.begin(), a.end(), cell(i));
+        build();
+    }
+    // k番目の要素 (K個の値) にaを足す．O(K*logN).
+    void add(int k, const value_type &a) {
+        assert(1 <= k and k <= sz);
+        for(; k <= sz; k += (k & -k)) {
+            T *p = cell(k);
+            for(int c = 0; c < K; ++c) p[c] += a[c];
+        }
+    }
+    // c番目のBITのk番目の要素にaを足す．O(logN).
+    void add(int k, int c, T a) {
+        assert(1 <= k and k <= sz);
+        assert(0 <= c and c < K);
+        for(; k <= sz; k += (k & -k)) cell(k)[c] += a;
+    }
+    // 区間[1,r]の総和をK個まとめて求める．O(K*logN).
+    value_type sum(int r) const {
+        assert(0 <= r and r <= sz);
+        value_type res;
+        res.fill(0);
+        for(; r > 0; r -= (r & -r)) {
+            const T *p = cell(r);
+            for(int c = 0; c < K; ++c) res[c] += p[c];
+        }
+        return res;
+    }
+    // 区間[l,r]の総和をK個まとめて求める．O(K*logN).
+    value_type sum(int l, int r) const {
+        assert(1 <= l and l <= r and r <= sz);
+        value_type res = sum(r);
+        const value_type sub = sum(l - 1);
+        for(int c = 0; c < K; ++c) res[c] -= sub[c];
+        return res;
+    }
+};
+
+}  // namespace algorithm
+
+#endif
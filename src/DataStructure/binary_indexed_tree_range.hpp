@@ -0,0 +1,67 @@
+#ifndef ALGORITHM_BINARY_INDEXED_TREE_RANGE_HPP
+#define ALGORITHM_BINARY_INDEXED_TREE_RANGE_HPP 1
+
+#include <cassert>
+#include <vector>
+
+#include "binary_indexed_tree.hpp"
+
+namespace algorithm {
+
+// 区間加算・区間和取得のBinary Indexed Tree.
+// 差分列d[]を用いて，prefix sum(r)=r*Σd[i]-Σd[i]*(i-1) (i=1..r) と表し，2つのBITで管理する．
+template <typename T>
+class RangeBIT {
+    int sz;     // sz:=(要素数).
+    BIT<T> b0;  // b0[i]:=d[i].
+    BIT<T> b1;  // b1[i]:=d[i]*(i-1).
+
+    void add0(int k, T a) {
+        if(k > sz) return;
+        b0.add(k, a);
+        b1.add(k, a * (k - 1));
+    }
+
+public:
+    // constructor. O(N).
+    RangeBIT() : RangeBIT(0) {}
+    explicit RangeBIT(size_t sz_) : sz(sz_), b0(sz_), b1(sz_) {}
+    explicit RangeBIT(const std::vector<T> &v) : sz(v.size()) {
+        std::vector<T> d0(sz), d1(sz);
+        for(int i = 0; i < sz; ++i) {
+            d0[i] = (i == 0 ? v[0] : v[i] - v[i - 1]);
+            d1[i] = d0[i] * i;
+        }
+        b0 = BIT<T>(d0), b1 = BIT<T>(d1);
+    }
+
+    int size() const { return sz; }
+    // 全要素をaで埋める．O(N).
+    void fill(T a = 0) {
+        b0.fill(0), b1.fill(0);
+        add(1, sz, a);
+    }
+    // k番目の要素にaを足す．O(logN).
+    void add(int k, T a) { add(k, k, a); }
+    // 区間[l,r]の各要素にaを足す．O(logN).
+    void add(int l, int r, T a) {
+        assert(1 <= l and l <= r + 1 and r <= sz);
+        if(l > r) return;
+        add0(l, a);
+        add0(r + 1, -a);
+    }
+    // 区間[1,r]の総和を求める．O(logN).
+    T sum(int r) const {
+        assert(0 <= r and r <= sz);
+        return b0.sum(r) * r - b1.sum(r);
+    }
+    // 区間[l,r]の総和を求める．O(logN).
+    T sum(int l, int r) const {
+        assert(1 <= l and l <= r and r <= sz);
+        return sum(r) - sum(l - 1);
+    }
+};
+
+}  // namespace algorithm
+
+#endif
@@ -2,147 +2,178 @@
 #define ALGORITHM_BINARY_TRIE_HPP 1
 
 #include <cassert>
+#include <ostream>
 #include <vector>
 
 namespace algorithm {
 
 // 非負整数値を扱うTrie木．
+// 節点は1つの配列 (プール) に確保し，子を32bitの添字で参照する．削除した節点は空きリストで再利用する．
 template <typename T = unsigned, int B = 32>  // T:データ型, B:ビット長.
 class BinaryTrie {
     struct Node {
-        int cnt;      // cnt:=(自身を根とする部分木に含まれる要素数).
-        Node *ch[2];  // ch[]:=(子のポインタ). 二分木．
-        Node() : cnt(0), ch({nullptr, nullptr}) {}
+        int cnt;    // cnt:=(自身を根とする部分木に含まれる要素数).
+        int ch[2];  // ch[]:=(子の添字). 0の場合，子は存在しない．
     };
 
-    Node *root;  // root:=(根のポインタ).
+    int root;                // root:=(根の添字). 0の場合，集合は空．
+    int free_head;           // free_head:=(空きリストの先頭). 空きリストはch[0]で連結する．
+    std::vector<Node> pool;  // pool[]:=(節点のプール). pool[0]は要素数0の番兵．
 
-    void delete_tree(Node *rt) {
-        if(rt == nullptr) return;
-        for(int i = 0; i < 2; ++i) {
-            delete_tree(rt->ch[i]);
-            rt->ch[i] = nullptr;
+    int new_node() {
+        if(free_head != 0) {
+            int p = free_head;
+            free_head = pool[p].ch[0];
+            pool[p] = (Node){0, {0, 0}};
+            return p;
         }
-        delete rt;
-        rt = nullptr;
+        pool.push_back((Node){0, {0, 0}});
+        return pool.size() - 1;
     }
-    Node *add(Node *p, T x, int shift = B - 1) {
-        if(p == nullptr) p = new Node;
-        p->cnt++;
-        if(shift < 0) return p;
-        bool flag = (x >> shift) & (T)1;
-        p->ch[flag] = add(p->ch[flag], x, shift - 1);
-        return p;
+    void release(int p) {
+        pool[p].ch[0] = free_head;
+        free_head = p;
     }
-    Node *sub(Node *p, T x, int shift = B - 1) {
-        assert(p != nullptr);
-        p->cnt--;
-        if(p->cnt == 0) {
-            delete_tree(p);
-            return p = nullptr;
+    T get_min(T bias) const {
+        assert(root != 0);
+        T res = 0;
+        int p = root;
+        for(int i = B - 1; i >= 0; --i) {
+            bool flag = (bias >> i) & (T)1;
+            if(pool[p].ch[flag] == 0) flag = !flag;
+            res |= (T)flag << i;
+            p = pool[p].ch[flag];
         }
-        if(shift < 0) return p;
-        bool flag = (x >> shift) & (T)1;
-        p->ch[flag] = sub(p->ch[flag], x, shift - 1);
-        return p;
-    }
-    T get_min(Node *p, T bias = 0, int shift = B - 1) const {
-        assert(p != nullptr);
-        if(shift < 0) return 0;
-        bool flag = (bias >> shift) & (T)1;
-        if(p->ch[flag] == nullptr) flag = !flag;
-        return get_min(p->ch[flag], bias, shift - 1) | ((T)flag << shift);
+        return res;
     }
-    T get(Node *p, int k, T bias = 0, int shift = B - 1) const {
-        assert(p != nullptr);
-        if(shift < 0) return 0;
-        bool flag = (bias >> shift) & (T)1;
-        int m = (p->ch[flag] == nullptr ? 0 : p->ch[flag]->cnt);
-        if(k < m) {
-            return get(p->ch[flag], k, bias, shift - 1) | ((T)flag << shift);
-        } else {
-            flag = !flag;
-            return get(p->ch[flag], k - m, bias, shift - 1) | ((T)flag << shift);
+    T get(int k, T bias) const {
+        T res = 0;
+        int p = root;
+        for(int i = B - 1; i >= 0; --i) {
+            bool flag = (bias >> i) & (T)1;
+            int m = pool[pool[p].ch[flag]].cnt;
+            if(k >= m) {
+                k -= m;
+                flag = !flag;
+            }
+            res |= (T)flag << i;
+            p = pool[p].ch[flag];
         }
+        return res;
     }
-    int count_lower(Node *p, T x, int shift = B - 1) const {
-        if(p == nullptr or shift < 0) return 0;
-        bool flag = (x >> shift) & (T)1;
-        return ((flag and p->ch[0] != nullptr) ? p->ch[0]->cnt : 0) + count_lower(p->ch[flag], x, shift - 1);
+    int count_lower(T x) const {
+        int res = 0;
+        int p = root;
+        for(int i = B - 1; i >= 0 and p != 0; --i) {
+            bool flag = (x >> i) & (T)1;
+            if(flag) res += pool[pool[p].ch[0]].cnt;
+            p = pool[p].ch[flag];
+        }
+        return res;
     }
-    void dfs(std::ostream &os, Node *p, int i, bool bits[]) const {
+    void dfs(std::ostream &os, int p, int i, bool bits[]) const {
         if(i == B) {
             os << "[";
             for(int j = 0; j < B; ++j) os << (bits[j] ? 1 : 0);
-            os << "] (num:" << p->cnt << ")" << std::endl;
+            os << "] (num:" << pool[p].cnt << ")" << std::endl;
             return;
         }
         for(int j = 0; j < 2; ++j) {
-            if(p->ch[j] != nullptr) {
+            if(pool[p].ch[j] != 0) {
                 bits[i] = j;
-                dfs(os, p->ch[j], i + 1, bits);
+                dfs(os, pool[p].ch[j], i + 1, bits);
             }
         }
     }
 
 public:
     // constructor.
-    BinaryTrie() : root(nullptr) {
+    BinaryTrie() : root(0), free_head(0), pool(1, (Node){0, {0, 0}}) {
         static_assert(B >= 1);
     }
-    ~BinaryTrie() {
-        clear();
-    }
 
     // 集合内でk番目に小さい値を取得．O(B).
     T operator[](int k) const {
         assert(0 <= k and k < size());
-        return get(root, k);
+        return get(k, 0);
     }
 
     // 要素数を返す．O(1).
-    int size() const { return (root == nullptr ? 0 : root->cnt); }
+    int size() const { return pool[root].cnt; }
     // 要素が空かどうか．O(1).
-    bool empty() const { return root == nullptr; }
+    bool empty() const { return root == 0; }
+    // 節点n個分のメモリを予め確保する．1要素の挿入で高々B+1個の節点を使う．
+    void reserve(int n) { pool.reserve(n + 1); }
     // 値xの要素数を返す．O(B).
     int count(T x) const {
-        if(root == nullptr) return 0;
-        Node *p = root;
+        int p = root;
+        for(int i = B - 1; i >= 0 and p != 0; --i) p = pool[p].ch[(x >> i) & (T)1];
+        return pool[p].cnt;
+    }
+    // 値xを集合に1つ追加．O(B).
+    void insert(T x) {
+        if(root == 0) root = new_node();
+        int p = root;
+        pool[p].cnt++;
         for(int i = B - 1; i >= 0; --i) {
-            p = p->ch[(x >> i) & (T)1];
-            if(p == nullptr) return 0;
+            bool flag = (x >> i) & (T)1;
+            if(pool[p].ch[flag] == 0) {
+                int q = new_node();  // プールが再確保されうるため，参照を保持しない．
+                pool[p].ch[flag] = q;
+            }
+            p = pool[p].ch[flag];
+            pool[p].cnt++;
         }
-        return p->cnt;
     }
-    // 値xを集合に1つ追加．O(B).
-    void insert(T x) { root = add(root, x); }
     // 値xを集合から1つ削除．O(B).
     void erace(T x) {
         assert(count(x) >= 1);
-        root = sub(root, x);
+        int p = root, par = 0;
+        bool pflag = 0;
+        for(int i = B;; --i) {
+            if(--pool[p].cnt == 0) {
+                // 要素数が0となった部分木は値xの経路のみからなるため，経路上の節点を解放する．
+                if(par == 0) root = 0;
+                else pool[par].ch[pflag] = 0;
+                for(int j = i;; --j) {
+                    int nxt = (j > 0 ? pool[p].ch[(x >> (j - 1)) & (T)1] : 0);
+                    release(p);
+                    if(j == 0) break;
+                    p = nxt;
+                }
+                return;
+            }
+            if(i == 0) return;
+            par = p, pflag = (x >> (i - 1)) & (T)1;
+            p = pool[p].ch[pflag];
+        }
     }
+    // 値xを集合から1つ削除．O(B).
+    void erase(T x) { erace(x); }
     // 集合内で値xとXORしたときに最小となる値を取得．O(B).
-    T min_element(T x = 0) const { return get_min(root, x); }
+    T min_element(T x = 0) const { return get_min(x); }
     // 集合内で値xとXORしたときに最大となる値を取得．O(B).
-    T max_element(T x = 0) const { return get_min(root, ~x); }
+    T max_element(T x = 0) const { return get_min(~x); }
     // 集合内で値xとXORしたときにk番目に小さい値を取得．O(B).
     T kth_element(int k, T x = 0) const {
         assert(0 <= k and k < size());
-        return get(root, k, x);
+        return get(k, x);
     }
     // 集合内で値x以上の最小の要素の番号を取得．O(B).
-    int lower_bound(T x) const { return count_lower(root, x); }
+    int lower_bound(T x) const { return count_lower(x); }
     // 集合内で値xより大きい最小の要素の番号を取得．O(B).
-    int upper_bound(T x) const { return count_lower(root, x + 1); }
+    int upper_bound(T x) const { return count_lower(x + 1); }
+    // 全要素を削除する．確保済みのメモリは保持する．O(1).
     void clear() {
-        delete_tree(root);
-        root = nullptr;
+        root = free_head = 0;
+        pool.resize(1);
     }
 
     friend std::ostream &operator<<(std::ostream &os, const BinaryTrie &ob) {
         if(ob.empty()) return os;
         bool bits[B] = {};
         ob.dfs(os, ob.root, 0, bits);
+        return os;
     }
 };
 
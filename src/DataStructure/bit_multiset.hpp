@@ -0,0 +1,91 @@
+#ifndef ALGORITHM_BIT_MULTISET_HPP
+#define ALGORITHM_BIT_MULTISET_HPP 1
+
+#include <algorithm>  // for lower_bound(), sort(), unique() and upper_bound().
+#include <cassert>
+#include <utility>  // for move().
+#include <vector>
+
+#include "binary_indexed_tree.hpp"
+
+namespace algorithm {
+
+// Binary Indexed Treeによる順序付き多重集合．
+// 挿入しうる値の候補を予め座標圧縮し，各値の個数をBITで管理する．
+// k番目の要素はBIT上の二分探索 (binary lifting) により求める．
+template <typename T>
+class BITMultiset {
+    std::vector<T> vals;  // vals[]:=(座標圧縮後の値の候補).
+    BIT<int> bit;         // bit[i]:=(値vals[i-1]の個数).
+    int cnt;              // cnt:=(要素数).
+
+    // 値xの候補内の位置 (1-based) を返す．
+    int index(const T &x) const {
+        int i = std::lower_bound(vals.begin(), vals.end(), x) - vals.begin();
+        assert(i < (int)vals.size() and vals[i] == x);
+        return i + 1;
+    }
+
+public:
+    // constructor. 値の候補candidatesを受け取る．O(NlogN).
+    BITMultiset() : BITMultiset(std::vector<T>()) {}
+    explicit BITMultiset(std::vector<T> candidates) : vals(std::move(candidates)), cnt(0) {
+        std::sort(vals.begin(), vals.end());
+        vals.erase(std::unique(vals.begin(), vals.end()), vals.end());
+        bit = BIT<int>(vals.size());
+    }
+
+    // 要素数を返す．
+    int size() const { return cnt; }
+    bool empty() const { return cnt == 0; }
+    // 値xをn個挿入する．ただしxは候補に含まれること．O(logN).
+    void insert(const T &x, int n = 1) {
+        assert(n >= 0);
+        bit.add(index(x), n);
+        cnt += n;
+    }
+    // 値xをn個削除する．ただしxがn個以上含まれること．O(logN).
+    void erase(const T &x, int n = 1) {
+        assert(n >= 0);
+        const int i = index(x);
+        assert(bit.sum(i, i) >= n);
+        bit.add(i, -n);
+        cnt -= n;
+    }
+    // 値xの個数を返す．O(logN).
+    int count(const T &x) const {
+        int i = std::lower_bound(vals.begin(), vals.end(), x) - vals.begin();
+        if(i == (int)vals.size() or !(vals[i] == x)) return 0;
+        return bit.sum(i + 1, i + 1);
+    }
+    // x未満の要素数を返す．xは候補に含まれなくてもよい．O(logN).
+    int count_less(const T &x) const {
+        int i = std::lower_bound(vals.begin(), vals.end(), x) - vals.begin();
+        return bit.sum(i);
+    }
+    // 小さい方からk番目 (0-based) の要素を返す．O(logN).
+    T kth(int k) const {
+        assert(0 <= k and k < cnt);
+        return vals[bit.lower_bound(k + 1) - 1];
+    }
+    // x以上の最小の要素を返す．ただしそのような要素が存在すること．O(logN).
+    T lower_bound(const T &x) const { return kth(count_less(x)); }
+    // xより大きい最小の要素を返す．ただしそのような要素が存在すること．O(logN).
+    T upper_bound(const T &x) const {
+        int i = std::upper_bound(vals.begin(), vals.end(), x) - vals.begin();
+        return kth(bit.sum(i));
+    }
+    // 最小の要素を返す．O(logN).
+    T min() const { return kth(0); }
+    // 最大の要素を返す．O(logN).
+    T max() const { return kth(cnt - 1); }
+    // 全要素を削除する．O(N).
+    void clear() {
+        bit.fill(0);
+        cnt = 0;
+    }
+};
+
+}  // namespace algorithm
+
+#endif
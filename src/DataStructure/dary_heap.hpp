@@ -0,0 +1,110 @@
+#ifndef ALGORITHM_DARY_HEAP_HPP
+#define ALGORITHM_DARY_HEAP_HPP 1
+
+#include <cassert>
+#include <functional>  // for less.
+#include <utility>     // for move() and forward().
+#include <vector>
+
+namespace algorithm {
+
+// D分ヒープ．
+// comp(a,b)=trueの場合，要素aは要素bより先に取り出される．既定では最小値を先頭とする．
+// 節点kの子は節点D*k+1～D*k+Dとなる (0-based index)．
+// 要素の交換を行わず，空き位置 (hole) を移動させてから要素を1度だけムーブする．
+template <typename T, int D = 4, class Compare = std::less<T> >
+class DaryHeap {
+    static_assert(D >= 2);
+
+    Compare comp;         // comp(T,T):=(比較関数オブジェクト).
+    std::vector<T> data;  // data[]:=(D分木). 0-based index.
+
+    // 空き位置kに値valを入れ，根の方向へ移動させる．O(log_D N).
+    void sift_up(int k, T &&val) {
+        while(k > 0) {
+            int par = (k - 1) / D;
+            if(!comp(val, data[par])) break;
+            data[k] = std::move(data[par]);
+            k = par;
+        }
+        data[k] = std::move(val);
+    }
+    // 空き位置kに値valを入れ，葉の方向へ移動させる．O(D*log_D N).
+    void sift_down(int k, T &&val) {
+        const int n = data.size();
+        while(1) {
+            int c = D * k + 1;
+            if(c >= n) break;
+            int best = c;
+            if(c + D <= n) {  // 子がD個揃う場合は反復回数を定数とし，ループを展開させる．
+                for(int i = 1; i < D; ++i) best = (comp(data[c + i], data[best]) ? c + i : best);
+            } else {
+                for(int i = c + 1; i < n; ++i) best = (comp(data[i], data[best]) ? i : best);
+            }
+            if(!comp(data[best], val)) break;
+            data[k] = std::move(data[best]);
+            k = best;
+        }
+        data[k] = std::move(val);
+    }
+    // 末尾の要素を先頭の空き位置に移し，ヒープ条件を回復する．O(D*log_D N).
+    void fill_root() {
+        T last = std::move(data.back());
+        data.pop_back();
+        if(!data.empty()) sift_down(0, std::move(last));
+    }
+
+public:
+    // constructor. O(N).
+    DaryHeap() : DaryHeap(Compare()) {}
+    explicit DaryHeap(const Compare &comp_) : comp(comp_) {}
+    explicit DaryHeap(std::vector<T> v, const Compare &comp_ = Compare()) : comp(comp_) { build(std::move(v)); }
+
+    // 要素数を返す．O(1).
+    int size() const { return data.size(); }
+    // 要素が空かどうか．O(1).
+    bool empty() const { return data.empty(); }
+    // 要素n個分のメモリを予め確保する．
+    void reserve(int n) { data.reserve(n); }
+    // 先頭の要素を返す．O(1).
+    const T &top() const {
+        assert(!empty());
+        return data[0];
+    }
+    // 要素aを挿入する．O(log_D N).
+    void push(const T &a) { push(T(a)); }
+    void push(T &&a) {
+        data.push_back(std::move(a));
+        T val = std::move(data.back());  // 末尾を空き位置とする．
+        sift_up(data.size() - 1, std::move(val));
+    }
+    // 引数argsから構築した要素を挿入する．O(log_D N).
+    template <typename... Args>
+    void emplace(Args &&...args) { push(T(std::forward<Args>(args)...)); }
+    // 先頭の要素を削除する．O(D*log_D N).
+    void pop() {
+        assert(!empty());
+        fill_root();
+    }
+    // 先頭の要素をoutにムーブし，削除する．O(D*log_D N).
+    void pop_into(T &out) {
+        assert(!empty());
+        out = std::move(data[0]);
+        fill_root();
+    }
+    // 要素列vからヒープを構築し直す．O(N).
+    void build(std::vector<T> v) {
+        data = std::move(v);
+        if(data.size() <= 1) return;
+        for(int k = ((int)data.size() - 2) / D; k >= 0; --k) {
+            T val = std::move(data[k]);
+            sift_down(k, std::move(val));
+        }
+    }
+    // 全要素を削除する．確保済みのメモリは保持する．O(N).
+    void clear() { data.clear(); }
+};
+
+}  // namespace algorithm
+
+#endif
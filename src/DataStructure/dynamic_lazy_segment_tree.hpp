@@ -0,0 +1,249 @@
+#ifndef ALGORITHM_DYNAMIC_LAZY_SEGMENT_TREE_HPP
+#define ALGORITHM_DYNAMIC_LAZY_SEGMENT_TREE_HPP 1
+
+#include <cassert>
+#include <vector>
+
+namespace algorithm {
+
+// 動的遅延評価セグメント木．
+// 64bit整数の添字範囲[lo,hi)を扱い，更新で辿った節点のみを1つの配列 (プール) に確保する．
+// 座標圧縮を行わずにオンラインで任意の添字を更新でき，メモリ使用量はO(QlogU)となる (U:=hi-lo)．
+// PolicyはStaticLazySegTreeと同じ形式の型．遅延評価が不要な場合は，作用を何もしない関数とすればよい．
+template <class Policy>
+class DynamicLazySegTree {
+public:
+    using monoid_type = typename Policy::monoid_type;
+    using action_type = typename Policy::action_type;
+
+private:
+    using Monoid = monoid_type;
+    using Action = action_type;
+
+    struct Node {
+        Monoid val;   // val:=(部分木の総積).
+        Action lazy;  // lazy:=(子に対する遅延評価).
+        int ch[2];    // ch[]:=(子の添字). 0の場合，子は未生成で全要素が初期値である．
+    };
+
+    Policy policy;             // policy:=(演算の集合).
+    Monoid e;                  // e:=(単位元).
+    Action id;                 // id:=(作用素の単位元).
+    long long lo, hi;          // [lo,hi):=(添字の範囲).
+    int height;                // height:=(木の高さ). 根は幅2^heightの区間を表す．
+    std::vector<Monoid> xpow;  // xpow[h]:=(初期値のみからなる幅2^hの区間の総積).
+    std::vector<Node> pool;    // pool[]:=(節点のプール). pool[0]は番兵，pool[1]は根．
+
+    Monoid op(const Monoid &a, const Monoid &b) const { return policy.op(a, b); }
+    void action(Monoid &a, const Action &d) const { policy.action(a, d); }
+    void composition(Action &d, const Action &d2) const { policy.composition(d, d2); }
+    void build(const Monoid &x) {
+        assert(lo <= hi and hi - lo <= (1LL << 62));
+        height = 0;
+        while((1LL << height) < hi - lo) height++;
+        xpow.assign(height + 1, x);
+        for(int h = 1; h <= height; ++h) xpow[h] = op(xpow[h - 1], xpow[h - 1]);
+        pool.clear();
+        pool.push_back((Node){e, id, {0, 0}});
+        pool.push_back((Node){xpow[height], id, {0, 0}});
+    }
+    int new_node(int h) {
+        pool.push_back((Node){xpow[h], id, {0, 0}});
+        return pool.size() - 1;
+    }
+    // 節点pに遅延評価を含めた作用を適用したときの値を返す (pは未生成でもよい)．
+    Monoid value(int p, int h, const Action &acc) const {
+        Monoid res = (p == 0 ? xpow[h] : pool[p].val);
+        action(res, acc);
+        return res;
+    }
+    void apply0(int p, const Action &d) {
+        action(pool[p].val, d);
+        composition(pool[p].lazy, d);
+    }
+    void push(int p, int h) {
+        assert(h >= 1);
+        for(int c = 0; c < 2; ++c) {
+            if(pool[p].ch[c] == 0) {
+                int q = new_node(h - 1);
+                pool[p].ch[c] = q;
+            }
+        }
+        const Action d = pool[p].lazy;
+        apply0(pool[p].ch[0], d);
+        apply0(pool[p].ch[1], d);
+        pool[p].lazy = id;
+    }
+    void update(int p) { pool[p].val = op(pool[pool[p].ch[0]].val, pool[pool[p].ch[1]].val); }
+    // 葉kまでの経路上の節点を遅延評価を伝播しながら辿り，path[h]に記録する．
+    int descend(long long k, int path[]) {
+        int p = 1;
+        for(int h = height; h >= 1; --h) {
+            push(p, h);
+            path[h] = p;
+            p = pool[p].ch[(k >> (h - 1)) & 1];
+        }
+        return p;
+    }
+    void apply(int p, int h, long long nl, long long l, long long r, const Action &d) {
+        const long long nr = nl + (1LL << h);
+        if(r <= nl or nr <= l) return;
+        if(l <= nl and nr <= r) {
+            apply0(p, d);
+            return;
+        }
+        push(p, h);
+        apply(pool[p].ch[0], h - 1, nl, l, r, d);
+        apply(pool[p].ch[1], h - 1, nl + (1LL << (h - 1)), l, r, d);
+        update(p);
+    }
+    // 節点を生成・変更せずに，祖先の遅延評価accを合成しながら区間積を求める．
+    Monoid prod(int p, int h, long long nl, long long l, long long r, const Action &acc) const {
+        const long long nr = nl + (1LL << h);
+        if(r <= nl or nr <= l) return e;
+        if(l <= nl and nr <= r) return value(p, h, acc);
+        Action d = pool[p].lazy;
+        composition(d, acc);
+        return op(prod(pool[p].ch[0], h - 1, nl, l, r, d),
+                  prod(pool[p].ch[1], h - 1, nl + (1LL << (h - 1)), l, r, d));
+    }
+    // 区間[l,r)内でjud(val•prod(l,x])=falseとなる最小のxを求める．存在しない場合は-1．
+    template <class Pred>
+    long long search_right(int p, int h, long long nl, long long l, long long r, const Pred &jud, Monoid &val, const Action &acc) const {
+        const long long nr = nl + (1LL << h);
+        if(r <= nl or nr <= l) return -1;
+        if(l <= nl and nr <= r) {
+            Monoid &&tmp = op(val, value(p, h, acc));
+            if(jud(tmp)) {
+                val = tmp;
+                return -1;
+            }
+            if(h == 0) return nl;
+        }
+        Action d = pool[p].lazy;
+        composition(d, acc);
+        long long res = search_right(pool[p].ch[0], h - 1, nl, l, r, jud, val, d);
+        if(res != -1) return res;
+        return search_right(pool[p].ch[1], h - 1, nl + (1LL << (h - 1)), l, r, jud, val, d);
+    }
+    // 区間[l,r)内でjud(prod[x,r)•val)=falseとなる最大のxを求める．存在しない場合は-1．
+    template <class Pred>
+    long long search_left(int p, int h, long long nl, long long l, long long r, const Pred &jud, Monoid &val, const Action &acc) const {
+        const long long nr = nl + (1LL << h);
+        if(r <= nl or nr <= l) return -1;
+        if(l <= nl and nr <= r) {
+            Monoid &&tmp = op(value(p, h, acc), val);
+            if(jud(tmp)) {
+                val = tmp;
+                return -1;
+            }
+            if(h == 0) return nl;
+        }
+        Action d = pool[p].lazy;
+        composition(d, acc);
+        long long res = search_left(pool[p].ch[1], h - 1, nl + (1LL << (h - 1)), l, r, jud, val, d);
+        if(res != -1) return res;
+        return search_left(pool[p].ch[0], h - 1, nl, l, r, jud, val, d);
+    }
+
+public:
+    // constructor. 添字の範囲を[lo,hi)とし，全要素を単位元とする．O(log(hi-lo)).
+    DynamicLazySegTree() : DynamicLazySegTree(0, 0) {}
+    explicit DynamicLazySegTree(long long lo_, long long hi_, const Policy &policy_ = Policy())
+        : policy(policy_), e(policy.identity()), id(policy.action_identity()), lo(lo_), hi(hi_) {
+        build(e);
+    }
+    // constructor. 添字の範囲を[lo,hi)とし，全要素をxとする．O(log(hi-lo)).
+    // 作用の結果が区間の長さに依存する場合 (区間代入と区間和など)，長さの情報をもつ値をxとして与える．
+    explicit DynamicLazySegTree(long long lo_, long long hi_, const Monoid &x, const Policy &policy_ = Policy())
+        : policy(policy_), e(policy.identity()), id(policy.action_identity()), lo(lo_), hi(hi_) {
+        build(x);
+    }
+
+    long long lower() const { return lo; }
+    long long upper() const { return hi; }
+    // モノイドの単位元を返す．
+    Monoid identity() const { return e; }
+    // 作用素の単位元を返す．
+    Action action_identity() const { return id; }
+    // 生成済みの節点数を返す．
+    int node_count() const { return pool.size() - 1; }
+    // 節点n個分のメモリを予め確保する．
+    void reserve(int n) { pool.reserve(n + 1); }
+    // k番目の要素をaに置き換える．O(logU).
+    void set(long long k, const Monoid &a) {
+        assert(lo <= k and k < hi);
+        int path[64];
+        int p = descend(k - lo, path);
+        pool[p].val = a;
+        for(int h = 1; h <= height; ++h) update(path[h]);
+    }
+    // k番目の要素を作用素dを用いて更新する．O(logU).
+    void apply(long long k, const Action &d) {
+        assert(lo <= k and k < hi);
+        int path[64];
+        int p = descend(k - lo, path);
+        action(pool[p].val, d);
+        for(int h = 1; h <= height; ++h) update(path[h]);
+    }
+    // 区間[l,r)を作用素dを用いて更新する．O(logU).
+    void apply(long long l, long long r, const Action &d) {
+        assert(lo <= l and l <= r and r <= hi);
+        if(l == r) return;
+        apply(1, height, 0, l - lo, r - lo, d);
+    }
+    // 一点取得．節点は生成しない．O(logU).
+    Monoid prod(long long k) const {
+        assert(lo <= k and k < hi);
+        k -= lo;
+        Action acc = id;
+        int p = 1;
+        for(int h = height; h >= 1; --h) {
+            if(p == 0) return value(0, 0, acc);
+            Action d = pool[p].lazy;
+            composition(d, acc);
+            acc = d;
+            p = pool[p].ch[(k >> (h - 1)) & 1];
+        }
+        return value(p, 0, acc);
+    }
+    // 区間[l,r)の総積 (v[l]•v[l+1]•....•v[r-1]) を求める．節点は生成しない．O(logU).
+    Monoid prod(long long l, long long r) const {
+        assert(lo <= l and l <= r and r <= hi);
+        if(l == r) return e;
+        return prod(1, height, 0, l - lo, r - lo, id);
+    }
+    // 区間全体の総積を返す．O(logU).
+    Monoid prod_all() const { return prod(lo, hi); }
+    // jud(prod(l,-))=trueとなる区間の最右位値を二分探索する．
+    // ただし要素列には単調性があり，またjud(e)=trueであること．O(logU).
+    template <class Pred>
+    long long most_right(const Pred &jud, long long l) const {
+        assert(jud(e));
+        assert(lo <= l and l <= hi);
+        if(l == hi) return hi;
+        Monoid val = e;
+        long long res = search_right(1, height, 0, l - lo, hi - lo, jud, val, id);
+        return (res == -1 ? hi : res + lo);
+    }
+    // jud(prod(-,r))=trueとなる区間の最左位値を二分探索する．
+    // ただし要素列には単調性があり，またjud(e)=trueであること．O(logU).
+    template <class Pred>
+    long long most_left(const Pred &jud, long long r) const {
+        assert(jud(e));
+        assert(lo <= r and r <= hi);
+        if(r == lo) return lo;
+        Monoid val = e;
+        long long res = search_left(1, height, 0, 0, r - lo, jud, val, id);
+        return (res == -1 ? lo : res + 1 + lo);
+    }
+    // 全要素を初期値に戻す．
+    void reset() {
+        Monoid x = xpow[0];
+        build(x);
+    }
+};
+
+}  // namespace algorithm
+
+#endif
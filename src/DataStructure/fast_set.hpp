@@ -0,0 +1,157 @@
+#ifndef ALGORITHM_FAST_SET_HPP
+#define ALGORITHM_FAST_SET_HPP 1
+
+#include <algorithm>  // for fill().
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace algorithm {
+
+// 64分木のビット集合による整数集合．
+// 区間[0,N)の整数を扱う．各段の1ワードが下の段の64ワードを要約し，各操作はO(log_64 N)で完了する．
+// 記憶域は約N/8バイト．
+class FastSet {
+    long long n;                               // n:=(扱う整数の範囲).
+    long long cnt;                             // cnt:=(要素数).
+    std::vector<std::vector<uint64_t> > seg;   // seg[h][]:=(段hのビット列). 段h+1のビットは段hのワードが0でないことを表す．
+    std::vector<std::vector<uint64_t> > full;  // full[h][]:=(段h-1のワードが全て1であることを表すビット列). h>=1.
+
+    static constexpr uint64_t ALL = ~(uint64_t)0;
+
+    static int ctz(uint64_t w) { return __builtin_ctzll(w); }
+    static int clz(uint64_t w) { return __builtin_clzll(w); }
+    // 段hにおいて「全て1」でないワードを表すビット列を返す．
+    uint64_t vacant(int h, long long i) const { return ~(h == 0 ? seg[0][i] : full[h][i]); }
+
+public:
+    // constructor. O(N/64).
+    FastSet() : FastSet(0) {}
+    explicit FastSet(long long n_) : n(n_), cnt(0) {
+        assert(n >= 0);
+        // 最下段は整数nを表すビットまで確保し，mex()の番兵とする．
+        long long m = (n >> 6) + 1;
+        while(1) {
+            seg.emplace_back(m, 0);
+            full.emplace_back(seg.size() == 1 ? 0 : m, 0);
+            if(m == 1) break;
+            m = (m + 63) >> 6;
+        }
+    }
+
+    // 扱う整数の範囲を返す．
+    long long universe() const { return n; }
+    // 要素数を返す．O(1).
+    long long size() const { return cnt; }
+    // 要素が空かどうか．O(1).
+    bool empty() const { return cnt == 0; }
+    // 整数xが集合に含まれるか判定する．O(1).
+    bool contains(long long x) const {
+        assert(0 <= x and x < n);
+        return (seg[0][x >> 6] >> (x & 63)) & 1ULL;
+    }
+    // 整数xを挿入する．O(log_64 N).
+    bool insert(long long x) {
+        assert(0 <= x and x < n);
+        if(contains(x)) return false;
+        cnt++;
+        const int m = seg.size();
+        long long y = x;
+        for(int h = 0; h < m; ++h, y >>= 6) {
+            uint64_t &w = seg[h][y >> 6];
+            const bool was_empty = (w == 0);
+            w |= 1ULL << (y & 63);
+            if(!was_empty) break;
+        }
+        // 全て1となったワードを上の段に伝える．
+        bool is_full = (seg[0][x >> 6] == ALL);
+        y = x >> 6;
+        for(int h = 1; h < m and is_full; ++h, y >>= 6) {
+            uint64_t &w = full[h][y >> 6];
+            w |= 1ULL << (y & 63);
+            is_full = (w == ALL);
+        }
+        return true;
+    }
+    // 整数xを削除する．O(log_64 N).
+    bool erase(long long x) {
+        assert(0 <= x and x < n);
+        if(!contains(x)) return false;
+        cnt--;
+        const int m = seg.size();
+        // 全て1でなくなるワードを上の段に伝える．
+        bool was_full = (seg[0][x >> 6] == ALL);
+        long long y = x >> 6;
+        for(int h = 1; h < m and was_full; ++h, y >>= 6) {
+            uint64_t &w = full[h][y >> 6];
+            was_full = (w == ALL);
+            w &= ~(1ULL << (y & 63));
+        }
+        y = x;
+        for(int h = 0; h < m; ++h, y >>= 6) {
+            uint64_t &w = seg[h][y >> 6];
+            w &= ~(1ULL << (y & 63));
+            if(w != 0) break;
+        }
+        return true;
+    }
+    // 集合に含まれるx以上の最小の整数を求める．存在しない場合は-1を返す．O(log_64 N).
+    long long next(long long x) const {
+        if(x < 0) x = 0;
+        if(x >= n) return -1;
+        for(int h = 0, m = seg.size(); h < m; ++h) {
+            if((x >> 6) == (long long)seg[h].size()) break;
+            uint64_t w = seg[h][x >> 6] >> (x & 63);
+            if(w == 0) {
+                x = (x >> 6) + 1;
+                continue;
+            }
+            x += ctz(w);
+            for(int g = h - 1; g >= 0; --g) x = (x << 6) | ctz(seg[g][x]);
+            return x;
+        }
+        return -1;
+    }
+    // 集合に含まれるx以下の最大の整数を求める．存在しない場合は-1を返す．O(log_64 N).
+    long long prev(long long x) const {
+        if(x >= n) x = n - 1;
+        if(x < 0) return -1;
+        for(int h = 0, m = seg.size(); h < m; ++h) {
+            if(x == -1) break;
+            uint64_t w = seg[h][x >> 6] << (63 - (x & 63));
+            if(w == 0) {
+                x = (x >> 6) - 1;
+                continue;
+            }
+            x -= clz(w);
+            for(int g = h - 1; g >= 0; --g) x = (x << 6) | (63 - clz(seg[g][x]));
+            return x;
+        }
+        return -1;
+    }
+    // 集合に含まれないx以上の整数の中で最小の値 (MEX:Minimum EXcluded value) を求める．O(log_64 N).
+    long long mex(long long x = 0) const {
+        assert(0 <= x and x <= n);
+        for(int h = 0, m = seg.size(); h < m; ++h) {
+            uint64_t w = vacant(h, x >> 6) >> (x & 63);
+            if(w == 0) {
+                x = (x >> 6) + 1;
+                continue;
+            }
+            x += ctz(w);
+            for(int g = h - 1; g >= 0; --g) x = (x << 6) | ctz(vacant(g, x));
+            return x;
+        }
+        return n;  // 到達しない．
+    }
+    // 全要素を削除する．O(N/64).
+    void clear() {
+        cnt = 0;
+        for(auto &v : seg) std::fill(v.begin(), v.end(), 0);
+        for(auto &v : full) std::fill(v.begin(), v.end(), 0);
+    }
+};
+
+}  // namespace algorithm
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef ALGORITHM_INDEXED_HEAP_HPP
+#define ALGORITHM_INDEXED_HEAP_HPP 1
+
+#include <cassert>
+#include <functional>  // for less.
+#include <utility>     // for move() and pair.
+#include <vector>
+
+namespace algorithm {
+
+// 添字付きD分ヒープ．
+// 添字v (0<=v<N) ごとに高々1つのキーをもち，キーの減少 (decrease-key) を行える．
+// 各添字のヒープ内の位置を記録するため，ヒープの大きさは常にN以下となる．記憶域はO(N)．
+// comp(a,b)=trueの場合，キーaはキーbより先に取り出される．既定では最小値を先頭とする．
+template <typename T, int D = 4, class Compare = std::less<T> >
+class IndexedHeap {
+    static_assert(D >= 2);
+
+    Compare comp;                          // comp(T,T):=(比較関数オブジェクト).
+    std::vector<std::pair<T, int> > data;  // data[]:=(D分木). 要素は(キー, 添字). 0-based index.
+    std::vector<int> pos;                  // pos[v]:=(添字vの要素のdata[]上の位置). 存在しない場合は-1.
+
+    // 空き位置kに要素eを入れ，根の方向へ移動させる．O(log_D N).
+    void sift_up(int k, std::pair<T, int> &&e) {
+        while(k > 0) {
+            int par = (k - 1) / D;
+            if(!comp(e.first, data[par].first)) break;
+            pos[data[par].second] = k;
+            data[k] = std::move(data[par]);
+            k = par;
+        }
+        pos[e.second] = k;
+        data[k] = std::move(e);
+    }
+    // 空き位置kに要素eを入れ，葉の方向へ移動させる．O(D*log_D N).
+    void sift_down(int k, std::pair<T, int> &&e) {
+        const int n = data.size();
+        while(1) {
+            int c = D * k + 1;
+            if(c >= n) break;
+            const int end = (c + D < n ? c + D : n);
+            int best = c;
+            for(int i = c + 1; i < end; ++i) best = (comp(data[i].first, data[best].first) ? i : best);
+            if(!comp(data[best].first, e.first)) break;
+            pos[data[best].second] = k;
+            data[k] = std::move(data[best]);
+            k = best;
+        }
+        pos[e.second] = k;
+        data[k] = std::move(e);
+    }
+
+public:
+    // constructor. O(N).
+    IndexedHeap() : IndexedHeap(0) {}
+    explicit IndexedHeap(int n, const Compare &comp_ = Compare()) : comp(comp_), pos(n, -1) {
+        assert(n >= 0);
+        data.reserve(n);
+    }
+
+    // 添字の範囲Nを返す．
+    int capacity() const { return pos.size(); }
+    // 要素数を返す．O(1).
+    int size() const { return data.size(); }
+    // 要素が空かどうか．O(1).
+    bool empty() const { return data.empty(); }
+    // 添字vの要素が含まれるか判定する．O(1).
+    bool contains(int v) const {
+        assert(0 <= v and v < capacity());
+        return pos[v] != -1;
+    }
+    // 添字vのキーを返す．O(1).
+    const T &key(int v) const {
+        assert(contains(v));
+        return data[pos[v]].first;
+    }
+    // 先頭の要素 (キー, 添字) を返す．O(1).
+    const std::pair<T, int> &top() const {
+        assert(!empty());
+        return data[0];
+    }
+    // 添字vの要素が存在しない場合はキーxで挿入し，存在する場合はキーxの方が先に取り出されるときに限り更新する．
+    // 挿入または更新した場合にtrueを返す．O(log_D N).
+    bool push_or_decrease(const T &x, int v) {
+        assert(0 <= v and v < capacity());
+        if(pos[v] == -1) {
+            data.emplace_back(x, v);
+            std::pair<T, int> e = std::move(data.back());  // 末尾を空き位置とする．
+            sift_up(data.size() - 1, std::move(e));
+            return true;
+        }
+        if(!comp(x, data[pos[v]].first)) return false;
+        sift_up(pos[v], std::pair<T, int>(x, v));
+        return true;
+    }
+    // 先頭の要素 (キー, 添字) を取り出して削除する．O(D*log_D N).
+    std::pair<T, int> pop_min() {
+        assert(!empty());
+        std::pair<T, int> res = std::move(data[0]);
+        pos[res.second] = -1;
+        std::pair<T, int> last = std::move(data.back());
+        data.pop_back();
+        if(!data.empty()) sift_down(0, std::move(last));
+        return res;
+    }
+    // 全要素を削除する．O(size()).
+    void clear() {
+        for(const auto &[_, v] : data) pos[v] = -1;
+        data.clear();
+    }
+};
+
+}  // namespace algorithm
+
+#endif
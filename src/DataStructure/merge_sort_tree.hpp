@@ -0,0 +1,99 @@
+#ifndef ALGORITHM_MERGE_SORT_TREE_HPP
+#define ALGORITHM_MERGE_SORT_TREE_HPP 1
+
+#include <algorithm>  // for lower_bound().
+#include <cassert>
+#include <vector>
+
+namespace algorithm {
+
+// 領域木の一種 (Merge Sort Tree)．
+// 各節点に部分木の要素を整列した列をもつ静的なセグメント木．添字の付け方はSegmentTreeと同じ．
+// 各節点の列の位置pに対し，先頭p個のうち左の子に由来する個数を記録しておく (Fractional Cascading)．
+// これにより根で1度だけ二分探索を行えば，子の列での位置をO(1)で求められる．
+template <typename T>
+class MergeSortTree {
+    int sz;                // sz:=(要素数).
+    int n;                 // n:=(葉数).
+    std::vector<int> ofs;  // ofs[k]:=(節点kの列の先頭位置). 節点kの列はval[ofs[k]:ofs[k+1]].
+    std::vector<T> val;    // val[]:=(全節点の整列済みの列を連結したもの).
+    std::vector<int> cas;  // cas[ofs[k]+k+p]:=(節点kの列の先頭p個のうち，左の子に由来する個数). 0<=p<=(列の長さ).
+
+    int length(int k) const { return ofs[k + 1] - ofs[k]; }
+    // 区間[l,r)のうち，節点kの列の先頭p個に含まれる要素数を求める．節点kは区間[nl,nr)を表す．
+    int count(int k, int nl, int nr, int l, int r, int p) const {
+        if(r <= nl or nr <= l or p == 0) return 0;
+        if(l <= nl and nr <= r) return p;
+        const int lp = cas[ofs[k] + k + p];
+        const int mid = (nl + nr) / 2;
+        return count(2 * k, nl, mid, l, r, lp) + count(2 * k + 1, mid, nr, l, r, p - lp);
+    }
+
+public:
+    // constructor. O(NlogN).
+    MergeSortTree() : MergeSortTree(std::vector<T>()) {}
+    explicit MergeSortTree(const std::vector<T> &v) : sz(v.size()), n(1) {
+        while(n < sz) n <<= 1;
+        std::vector<int> len(2 * n, 0);
+        for(int i = 0; i < sz; ++i) len[i + n] = 1;
+        for(int k = n - 1; k >= 1; --k) len[k] = len[2 * k] + len[2 * k + 1];
+        ofs.assign(2 * n + 1, 0);
+        for(int k = 1; k < 2 * n; ++k) ofs[k + 1] = ofs[k] + len[k];
+        val.resize(ofs[2 * n]);
+        cas.assign(ofs[2 * n] + 2 * n, 0);
+        for(int i = 0; i < sz; ++i) val[ofs[i + n]] = v[i];
+        for(int k = n - 1; k >= 1; --k) {
+            int i = ofs[2 * k], j = ofs[2 * k + 1];
+            const int il = ofs[2 * k + 1], jl = ofs[2 * k + 2];
+            int *c = &cas[ofs[k] + k];
+            for(int p = ofs[k]; p < ofs[k + 1]; ++p) {
+                c[1] = c[0];
+                if(j == jl or (i < il and !(val[j] < val[i]))) {
+                    val[p] = val[i++];
+                    c[1]++;
+                } else {
+                    val[p] = val[j++];
+                }
+                c++;
+            }
+        }
+    }
+
+    // 要素数を返す．
+    int size() const { return sz; }
+    // 区間[l,r)のうち，値がx未満の要素数を求める．O(logN).
+    int count_less(int l, int r, const T &x) const {
+        assert(0 <= l and l <= r and r <= sz);
+        if(l == r) return 0;
+        const int p = std::lower_bound(val.begin() + ofs[1], val.begin() + ofs[2], x) - (val.begin() + ofs[1]);
+        return count(1, 0, n, l, r, p);
+    }
+    // 区間[l,r)のうち，値が[lower,upper)に含まれる要素数を求める．O(logN).
+    int count(int l, int r, const T &lower, const T &upper) const {
+        assert(0 <= l and l <= r and r <= sz);
+        if(!(lower < upper)) return 0;
+        return count_less(l, r, upper) - count_less(l, r, lower);
+    }
+    // 区間[l,r)の要素のうち，小さい方からk番目 (0-based) の値を求める．O(log^2N).
+    T kth_smallest(int l, int r, int k) const {
+        assert(0 <= l and l <= r and r <= sz);
+        assert(0 <= k and k < r - l);
+        // 根の列の先頭p個に区間内の要素がk+1個以上含まれる最小のpを二分探索する．
+        int ng = 0, ok = length(1);
+        while(ok - ng > 1) {
+            int mid = (ng + ok) / 2;
+            (count(1, 0, n, l, r, mid) > k ? ok : ng) = mid;
+        }
+        return val[ofs[1] + ok - 1];
+    }
+    // 区間[l,r)の要素のうち，大きい方からk番目 (0-based) の値を求める．O(log^2N).
+    T kth_largest(int l, int r, int k) const {
+        assert(0 <= l and l <= r and r <= sz);
+        assert(0 <= k and k < r - l);
+        return kth_smallest(l, r, r - l - k - 1);
+    }
+};
+
+}  // namespace algorithm
+
+#endif
@@ -0,0 +1,199 @@
+#ifndef ALGORITHM_PATRICIA_TRIE_HPP
+#define ALGORITHM_PATRICIA_TRIE_HPP 1
+
+#include <cassert>
+#include <vector>
+
+namespace algorithm {
+
+// 非負整数値を扱うパス圧縮Trie木 (Patricia Trie)．
+// 分岐のない経路を1つの節点にまとめるため，内部節点は必ず2つの子をもち，節点数は高々2N-1となる．
+// 根から葉までの深さは，ビット長Bではなく要素の種類数で抑えられる．
+// 取得操作はBinaryTrieと同じ．
+template <typename T = unsigned, int B = 32>  // T:データ型, B:ビット長.
+class PatriciaTrie {
+    static_assert(1 <= B and B <= 64);
+    static_assert(sizeof(T) <= sizeof(unsigned long long));
+
+    struct Node {
+        T key;      // key:=(部分木に含まれる値の1つ). 上位lenビットが部分木で共通の接頭辞．
+        int len;    // len:=(接頭辞のビット長). len=Bの場合，葉．
+        int cnt;    // cnt:=(自身を根とする部分木に含まれる要素数).
+        int ch[2];  // ch[]:=(子の添字).
+    };
+
+    int root;                // root:=(根の添字). 0の場合，集合は空．
+    int free_head;           // free_head:=(空きリストの先頭). 空きリストはch[0]で連結する．
+    std::vector<Node> pool;  // pool[]:=(節点のプール). pool[0]は要素数0の番兵．
+
+    // 値xの上位lenビットを返す．
+    static T prefix(T x, int len) { return (len == 0 ? 0 : x >> (B - len)); }
+    // 値xの上位から(len+1)ビット目を返す．
+    static bool bit(T x, int len) { return (x >> (B - 1 - len)) & (T)1; }
+    // 値aと値bの上位ビットの共通部分の長さを返す．
+    static int lcp(T a, T b) {
+        unsigned long long d = a ^ b;
+        if(d == 0) return B;
+        return B - 64 + __builtin_clzll(d);
+    }
+    int new_node(T key, int len, int cnt) {
+        int p;
+        if(free_head != 0) {
+            p = free_head;
+            free_head = pool[p].ch[0];
+        } else {
+            p = pool.size();
+            pool.push_back((Node){});
+        }
+        pool[p] = (Node){key, len, cnt, {0, 0}};
+        return p;
+    }
+    void release(int p) {
+        pool[p].ch[0] = free_head;
+        free_head = p;
+    }
+    // 節点parの子dir (parが0の場合は根) を節点pに付け替える．
+    void link(int par, bool dir, int p) {
+        if(par == 0) root = p;
+        else pool[par].ch[dir] = p;
+    }
+    T get(int k, T bias) const {
+        int p = root;
+        while(pool[p].len < B) {
+            bool flag = bit(bias, pool[p].len);
+            int m = pool[pool[p].ch[flag]].cnt;
+            if(k >= m) {
+                k -= m;
+                flag = !flag;
+            }
+            p = pool[p].ch[flag];
+        }
+        return pool[p].key;
+    }
+    int count_lower(T x) const {
+        int res = 0;
+        int p = root;
+        while(p != 0) {
+            const int len = pool[p].len;
+            const T a = prefix(pool[p].key, len), b = prefix(x, len);
+            if(a != b) {
+                if(a < b) res += pool[p].cnt;
+                break;
+            }
+            if(len == B) break;
+            bool flag = bit(x, len);
+            if(flag) res += pool[pool[p].ch[0]].cnt;
+            p = pool[p].ch[flag];
+        }
+        return res;
+    }
+
+public:
+    // constructor.
+    PatriciaTrie() : root(0), free_head(0), pool(1, (Node){0, B, 0, {0, 0}}) {}
+
+    // 集合内でk番目に小さい値を取得．O(min(N,B)).
+    T operator[](int k) const {
+        assert(0 <= k and k < size());
+        return get(k, 0);
+    }
+
+    // 要素数を返す．O(1).
+    int size() const { return pool[root].cnt; }
+    // 要素が空かどうか．O(1).
+    bool empty() const { return root == 0; }
+    // 要素の種類数n個分のメモリを予め確保する．
+    void reserve(int n) { pool.reserve(2 * n); }
+    // 値xの要素数を返す．O(min(N,B)).
+    int count(T x) const {
+        int p = root;
+        while(p != 0) {
+            const int len = pool[p].len;
+            if(prefix(pool[p].key, len) != prefix(x, len)) return 0;
+            if(len == B) return pool[p].cnt;
+            p = pool[p].ch[bit(x, len)];
+        }
+        return 0;
+    }
+    // 値xを集合に1つ追加．O(min(N,B)).
+    void insert(T x) {
+        if(root == 0) {
+            root = new_node(x, B, 1);
+            return;
+        }
+        int par = 0, p = root;
+        bool dir = 0;
+        while(1) {
+            const int len = pool[p].len;
+            const int c = lcp(x, pool[p].key);
+            if(c < len) {
+                // 接頭辞が途中で分岐するため，分岐点となる内部節点を挿入する．
+                int leaf = new_node(x, B, 1);
+                int q = new_node(x, c, pool[p].cnt + 1);
+                bool flag = bit(x, c);
+                pool[q].ch[flag] = leaf, pool[q].ch[!flag] = p;
+                link(par, dir, q);
+                return;
+            }
+            pool[p].cnt++;
+            if(len == B) return;
+            par = p, dir = bit(x, len);
+            p = pool[p].ch[dir];
+        }
+    }
+    // 値xを集合から1つ削除．O(min(N,B)).
+    void erace(T x) {
+        assert(count(x) >= 1);
+        int gpar = 0, par = 0, p = root;
+        bool gdir = 0, dir = 0;
+        while(pool[p].len < B) {
+            pool[p].cnt--;
+            gpar = par, gdir = dir;
+            par = p, dir = bit(x, pool[p].len);
+            p = pool[p].ch[dir];
+        }
+        if(--pool[p].cnt > 0) return;
+        // 葉を削除し，子が1つになった親を兄弟の節点で置き換える．
+        release(p);
+        if(par == 0) {
+            root = 0;
+            return;
+        }
+        link(gpar, gdir, pool[par].ch[!dir]);
+        release(par);
+    }
+    // 値xを集合から1つ削除．O(min(N,B)).
+    void erase(T x) { erace(x); }
+    // 集合内で値xとXORしたときに最小となる値を取得．O(min(N,B)).
+    T min_element(T x = 0) const {
+        assert(!empty());
+        int p = root;
+        while(pool[p].len < B) p = pool[p].ch[bit(x, pool[p].len)];
+        return pool[p].key;
+    }
+    // 集合内で値xとXORしたときに最大となる値を取得．O(min(N,B)).
+    T max_element(T x = 0) const { return min_element(~x); }
+    // 集合内で値xとXORしたときにk番目に小さい値を取得．O(min(N,B)).
+    T kth_element(int k, T x = 0) const {
+        assert(0 <= k and k < size());
+        return get(k, x);
+    }
+    // 集合内で値x以上の最小の要素の番号を取得．O(min(N,B)).
+    int lower_bound(T x) const { return count_lower(x); }
+    // 集合内で値xより大きい最小の要素の番号を取得．O(min(N,B)).
+    int upper_bound(T x) const {
+        // xがBビットで表せる最大値の場合，x+1は桁あふれするため全要素数を返す．
+        const T y = x + 1;
+        if(y == 0 or (y >> (B - 1) >> 1) != 0) return size();
+        return count_lower(y);
+    }
+    // 全要素を削除する．確保済みのメモリは保持する．O(1).
+    void clear() {
+        root = free_head = 0;
+        pool.resize(1);
+    }
+};
+
+}  // namespace algorithm
+
+#endif
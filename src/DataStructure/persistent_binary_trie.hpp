@@ -0,0 +1,106 @@
+#ifndef ALGORITHM_PERSISTENT_BINARY_TRIE_HPP
+#define ALGORITHM_PERSISTENT_BINARY_TRIE_HPP 1
+
+#include <cassert>
+#include <vector>
+
+namespace algorithm {
+
+// 永続Binary Trie．
+// 数列a[]の各接頭辞a[0:i]に対応する版をもち，2つの版の差をとることで区間[l,r)の要素に関する取得操作を行う．
+// 要素を追加するごとに根から葉までの経路を複製する．節点は1つの配列 (プール) に確保する．
+template <typename T = unsigned, int B = 32>  // T:データ型, B:ビット長.
+class PersistentBinaryTrie {
+    struct Node {
+        int cnt;    // cnt:=(自身を根とする部分木に含まれる要素数).
+        int ch[2];  // ch[]:=(子の添字).
+    };
+
+    std::vector<Node> pool;  // pool[]:=(節点のプール). pool[0]は空の部分木を表す．
+    std::vector<int> roots;  // roots[i]:=(接頭辞a[0:i]に対応する版の根の添字).
+
+    int cnt(int pl, int pr) const { return pool[pr].cnt - pool[pl].cnt; }
+
+public:
+    // constructor. O(N*B).
+    PersistentBinaryTrie() : pool(1, (Node){0, {0, 0}}), roots(1, 0) {
+        static_assert(B >= 1);
+    }
+    explicit PersistentBinaryTrie(const std::vector<T> &v) : PersistentBinaryTrie() {
+        reserve(v.size());
+        for(const T &x : v) push_back(x);
+    }
+
+    // 要素数を返す．
+    int size() const { return roots.size() - 1; }
+    // 要素n個分のメモリを予め確保する．
+    void reserve(int n) {
+        pool.reserve(pool.size() + (long long)n * (B + 1));
+        roots.reserve(roots.size() + n);
+    }
+    // 数列の末尾に値xを追加し，新しい版を作る．O(B).
+    void push_back(T x) {
+        int prev = roots.back();
+        int p = pool.size();
+        roots.push_back(p);
+        pool.push_back((Node){pool[prev].cnt + 1, {pool[prev].ch[0], pool[prev].ch[1]}});
+        for(int i = B - 1; i >= 0; --i) {
+            bool flag = (x >> i) & (T)1;
+            prev = pool[prev].ch[flag];
+            int q = pool.size();
+            pool.push_back((Node){pool[prev].cnt + 1, {pool[prev].ch[0], pool[prev].ch[1]}});
+            pool[p].ch[flag] = q;
+            p = q;
+        }
+    }
+    // max{a[i] xor x | l<=i<r} を求める．O(B).
+    T max_xor(int l, int r, T x) const {
+        assert(0 <= l and l < r and r <= size());
+        int pl = roots[l], pr = roots[r];
+        T res = 0;
+        for(int i = B - 1; i >= 0; --i) {
+            bool flag = !((x >> i) & (T)1);
+            if(cnt(pool[pl].ch[flag], pool[pr].ch[flag]) > 0) res |= (T)1 << i;
+            else flag = !flag;
+            pl = pool[pl].ch[flag], pr = pool[pr].ch[flag];
+        }
+        return res;
+    }
+    // min{a[i] xor x | l<=i<r} を求める．O(B).
+    T min_xor(int l, int r, T x) const { return kth_xor(l, r, 0, x); }
+    // {a[i] xor x | l<=i<r} のうち小さい方からk番目 (0-based) の値を求める．O(B).
+    T kth_xor(int l, int r, int k, T x) const {
+        assert(0 <= l and l < r and r <= size());
+        assert(0 <= k and k < r - l);
+        int pl = roots[l], pr = roots[r];
+        T res = 0;
+        for(int i = B - 1; i >= 0; --i) {
+            bool flag = (x >> i) & (T)1;
+            int m = cnt(pool[pl].ch[flag], pool[pr].ch[flag]);
+            if(k >= m) {
+                k -= m;
+                flag = !flag;
+                res |= (T)1 << i;
+            }
+            pl = pool[pl].ch[flag], pr = pool[pr].ch[flag];
+        }
+        return res;
+    }
+    // l<=i<r かつ (a[i] xor y)<x を満たすiの個数を求める．O(B).
+    int count_less(int l, int r, T x, T y = 0) const {
+        assert(0 <= l and l <= r and r <= size());
+        int pl = roots[l], pr = roots[r];
+        int res = 0;
+        for(int i = B - 1; i >= 0; --i) {
+            bool xb = (x >> i) & (T)1, yb = (y >> i) & (T)1;
+            if(xb) res += cnt(pool[pl].ch[yb], pool[pr].ch[yb]);
+            pl = pool[pl].ch[yb ^ xb], pr = pool[pr].ch[yb ^ xb];
+            if(pl == pr) break;  // 以降の部分木に区間内の要素は含まれない．
+        }
+        return res;
+    }
+};
+
+}  // namespace algorithm
+
+#endif
@@ -0,0 +1,181 @@
+#ifndef ALGORITHM_PERSISTENT_SEGMENT_TREE_HPP
+#define ALGORITHM_PERSISTENT_SEGMENT_TREE_HPP 1
+
+#include <cassert>
+#include <cstddef>  // for size_t.
+#include <vector>
+
+namespace algorithm {
+
+// 永続セグメント木．
+// 更新ごとに根から葉までの経路を複製して新しい版を作り，過去の全ての版に対して取得操作を行える．
+// 節点は1つの配列 (プール) に確保し，子を添字で参照する．
+// MonoidはStaticSegmentTreeと同じ形式の型．
+template <class Monoid>
+class PersistentSegmentTree {
+public:
+    using value_type = typename Monoid::value_type;
+
+private:
+    using T = value_type;
+
+    struct Node {
+        T val;      // val:=(部分木の総積).
+        int ch[2];  // ch[]:=(子の添字).
+    };
+
+    Monoid monoid;           // monoid:=(モノイド). 演算op()と単位元identity()をもつ．
+    T e;                     // e:=(単位元).
+    int sz;                  // sz:=(要素数).
+    std::vector<Node> pool;  // pool[]:=(節点のプール). pool[0]は単位元のみからなる部分木を表す．
+    std::vector<int> roots;  // roots[v]:=(版vの根の添字).
+
+    T op(const T &a, const T &b) const { return monoid.op(a, b); }
+    int new_node(const T &val, int lch, int rch) {
+        pool.push_back((Node){val, {lch, rch}});
+        return pool.size() - 1;
+    }
+    int build(const std::vector<T> &v, int lo, int hi) {
+        if(hi - lo == 1) return new_node(v[lo], 0, 0);
+        int mid = (lo + hi) / 2;
+        int lch = build(v, lo, mid), rch = build(v, mid, hi);
+        return new_node(op(pool[lch].val, pool[rch].val), lch, rch);
+    }
+    int set(int p, int lo, int hi, int k, const T &a) {
+        if(hi - lo == 1) return new_node(a, 0, 0);
+        int mid = (lo + hi) / 2;
+        int lch = pool[p].ch[0], rch = pool[p].ch[1];
+        if(k < mid)
+            lch = set(lch, lo, mid, k, a);
+        else
+            rch = set(rch, mid, hi, k, a);
+        return new_node(op(pool[lch].val, pool[rch].val), lch, rch);
+    }
+    T prod(int p, int lo, int hi, int l, int r) const {
+        if(p == 0 or r <= lo or hi <= l) return e;
+        if(l <= lo and hi <= r) return pool[p].val;
+        int mid = (lo + hi) / 2;
+        return op(prod(pool[p].ch[0], lo, mid, l, r), prod(pool[p].ch[1], mid, hi, l, r));
+    }
+    template <class Pred>
+    int search_right(int p, int lo, int hi, int l, const Pred &jud, T &val) const {
+        if(hi <= l) return hi;
+        if(l <= lo) {
+            T &&tmp = op(val, pool[p].val);
+            if(jud(tmp)) {
+                val = tmp;
+                return hi;
+            }
+            if(hi - lo == 1) return lo;
+        }
+        int mid = (lo + hi) / 2;
+        int res = search_right(pool[p].ch[0], lo, mid, l, jud, val);
+        if(res < mid) return res;
+        return search_right(pool[p].ch[1], mid, hi, l, jud, val);
+    }
+    template <class Pred>
+    int search_left(int p, int lo, int hi, int r, const Pred &jud, T &val) const {
+        if(r <= lo) return lo;
+        if(hi <= r) {
+            T &&tmp = op(pool[p].val, val);
+            if(jud(tmp)) {
+                val = tmp;
+                return lo;
+            }
+            if(hi - lo == 1) return hi;
+        }
+        int mid = (lo + hi) / 2;
+        int res = search_left(pool[p].ch[1], mid, hi, r, jud, val);
+        if(res > mid) return res;
+        return search_left(pool[p].ch[0], lo, mid, r, jud, val);
+    }
+
+public:
+    // constructor. 全要素が単位元である版0を作る．O(1).
+    PersistentSegmentTree() : PersistentSegmentTree(0) {}
+    explicit PersistentSegmentTree(size_t sz_, const Monoid &monoid_ = Monoid())
+        : monoid(monoid_), e(monoid.identity()), sz(sz_), pool(1, (Node){e, {0, 0}}), roots(1, 0) {}
+    // constructor. 要素列vを版0とする．O(N).
+    explicit PersistentSegmentTree(const std::vector<T> &v, const Monoid &monoid_ = Monoid())
+        : monoid(monoid_), e(monoid.identity()), sz(v.size()), pool(1, (Node){e, {0, 0}}), roots(1, 0) {
+        if(sz == 0) return;
+        pool.reserve(2 * sz);
+        roots[0] = build(v, 0, sz);
+    }
+
+    // 要素数を返す．
+    int size() const { return sz; }
+    // 単位元を返す．
+    T identity() const { return e; }
+    // 版の数を返す．
+    int version_count() const { return roots.size(); }
+    // 最新の版の番号を返す．
+    int latest() const { return roots.size() - 1; }
+    // 節点n個分のメモリを予め確保する．
+    void reserve(int n) { pool.reserve(n); }
+    // 版verのk番目の要素をaに置き換えた新しい版を作り，その番号を返す．O(logN).
+    int set(int ver, int k, const T &a) {
+        assert(0 <= ver and ver < version_count());
+        assert(0 <= k and k < sz);
+        int rt = set(roots[ver], 0, sz, k, a);
+        roots.push_back(rt);
+        return latest();
+    }
+    // 版verのk番目の要素にaを加えた新しい版を作り，その番号を返す．O(logN).
+    int add(int ver, int k, const T &a) {
+        T val = prod(ver, k);
+        val += a;
+        return set(ver, k, val);
+    }
+    // 版verのk番目の要素を取得する．O(logN).
+    T prod(int ver, int k) const {
+        assert(0 <= ver and ver < version_count());
+        assert(0 <= k and k < sz);
+        int p = roots[ver], lo = 0, hi = sz;
+        while(hi - lo > 1) {
+            int mid = (lo + hi) / 2;
+            if(k < mid)
+                p = pool[p].ch[0], hi = mid;
+            else
+                p = pool[p].ch[1], lo = mid;
+        }
+        return pool[p].val;
+    }
+    // 版verの区間[l,r)の総積（v[l]•v[l+1]•....•v[r-1]）を求める．O(logN).
+    T prod(int ver, int l, int r) const {
+        assert(0 <= ver and ver < version_count());
+        assert(0 <= l and l <= r and r <= sz);
+        return prod(roots[ver], 0, sz, l, r);
+    }
+    // 版verの区間全体の総積を返す．O(1).
+    T prod_all(int ver) const {
+        assert(0 <= ver and ver < version_count());
+        return pool[roots[ver]].val;
+    }
+    // 版verにおいてjud(prod(l,-))=trueとなる区間の最右位値を二分探索する．
+    // ただし要素列には単調性があり，またjud(e)=trueであること．O(logN).
+    template <class Pred>
+    int most_right(int ver, const Pred &jud, int l) const {
+        assert(0 <= ver and ver < version_count());
+        assert(jud(e) == true);
+        assert(0 <= l and l <= sz);
+        if(l == sz) return sz;
+        T val = e;
+        return search_right(roots[ver], 0, sz, l, jud, val);
+    }
+    // 版verにおいてjud(prod(-,r))=trueとなる区間の最左位値を二分探索する．
+    // ただし要素列には単調性があり，またjud(e)=trueであること．O(logN).
+    template <class Pred>
+    int most_left(int ver, const Pred &jud, int r) const {
+        assert(0 <= ver and ver < version_count());
+        assert(jud(e) == true);
+        assert(0 <= r and r <= sz);
+        if(r == 0) return 0;
+        T val = e;
+        return search_left(roots[ver], 0, sz, r, jud, val);
+    }
+};
+
+}  // namespace algorithm
+
+#endif
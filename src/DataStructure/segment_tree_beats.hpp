@@ -0,0 +1,220 @@
+#ifndef ALGORITHM_SEGMENT_TREE_BEATS_HPP
+#define ALGORITHM_SEGMENT_TREE_BEATS_HPP 1
+
+#include <algorithm>  // for max() and min().
+#include <cassert>
+#include <limits>
+#include <vector>
+
+namespace algorithm {
+
+// Segment Tree Beats.
+// 区間chmin・区間chmax・区間加算と，区間和・区間最小値・区間最大値の取得を扱う．
+// 各節点で最大値・第2最大値 (最小値についても同様) を保持し，作用が単一の遅延評価に収まらない節点でのみ子へ降りる．
+// 計算量は償却O((N+Q)log^2N).
+template <typename T>
+class SegmentTreeBeats {
+    struct Node {
+        T max1, max2;  // max1:=(最大値), max2:=(第2最大値).
+        T min1, min2;  // min1:=(最小値), min2:=(第2最小値).
+        int maxc;      // maxc:=(最大値の個数).
+        int minc;      // minc:=(最小値の個数).
+        int len;       // len:=(区間の要素数).
+        T sum;         // sum:=(区間和).
+        T lazy;        // lazy:=(子に対する加算の遅延評価).
+    };
+
+    static constexpr T INF = std::numeric_limits<T>::max();
+    static constexpr T NINF = std::numeric_limits<T>::lowest();
+
+    int sz;                  // sz:=(要素数).
+    int n;                   // n:=(二分木の葉数).
+    std::vector<Node> tree;  // tree(2n)[]:=(完全二分木). 1-based index.
+
+    void build() {
+        n = 1;
+        while(n < sz) n <<= 1;
+        tree.assign(2 * n, (Node){NINF, NINF, INF, INF, 0, 0, 0, 0, 0});
+    }
+    void set_leaf(int k, T a) {
+        tree[k] = (Node){a, NINF, a, INF, 1, 1, 1, a, 0};
+    }
+    void update(int k) {
+        const Node &l = tree[2 * k], &r = tree[2 * k + 1];
+        Node &nd = tree[k];
+        nd.sum = l.sum + r.sum;
+        nd.len = l.len + r.len;
+        if(l.max1 > r.max1) {
+            nd.max1 = l.max1, nd.maxc = l.maxc, nd.max2 = std::max(l.max2, r.max1);
+        } else if(l.max1 < r.max1) {
+            nd.max1 = r.max1, nd.maxc = r.maxc, nd.max2 = std::max(l.max1, r.max2);
+        } else {
+            nd.max1 = l.max1, nd.maxc = l.maxc + r.maxc, nd.max2 = std::max(l.max2, r.max2);
+        }
+        if(l.min1 < r.min1) {
+            nd.min1 = l.min1, nd.minc = l.minc, nd.min2 = std::min(l.min2, r.min1);
+        } else if(l.min1 > r.min1) {
+            nd.min1 = r.min1, nd.minc = r.minc, nd.min2 = std::min(l.min1, r.min2);
+        } else {
+            nd.min1 = l.min1, nd.minc = l.minc + r.minc, nd.min2 = std::min(l.min2, r.min2);
+        }
+    }
+    void apply_add(int k, T a) {
+        Node &nd = tree[k];
+        if(nd.len == 0) return;
+        nd.max1 += a, nd.min1 += a;
+        if(nd.max2 != NINF) nd.max2 += a;
+        if(nd.min2 != INF) nd.min2 += a;
+        nd.sum += a * nd.len;
+        nd.lazy += a;
+    }
+    // 最大値のみをaに下げる．ただしmax2<a<max1であること．
+    void apply_chmin(int k, T a) {
+        Node &nd = tree[k];
+        nd.sum += (a - nd.max1) * nd.maxc;
+        if(nd.max1 == nd.min1) nd.min1 = a;
+        else if(nd.max1 == nd.min2) nd.min2 = a;
+        nd.max1 = a;
+    }
+    // 最小値のみをaに上げる．ただしmin1<a<min2であること．
+    void apply_chmax(int k, T a) {
+        Node &nd = tree[k];
+        nd.sum += (a - nd.min1) * nd.minc;
+        if(nd.min1 == nd.max1) nd.max1 = a;
+        else if(nd.min1 == nd.max2) nd.max2 = a;
+        nd.min1 = a;
+    }
+    void push(int k) {
+        assert(1 <= k and k < n);
+        if(tree[k].lazy != 0) {
+            apply_add(2 * k, tree[k].lazy);
+            apply_add(2 * k + 1, tree[k].lazy);
+            tree[k].lazy = 0;
+        }
+        for(int c = 2 * k; c <= 2 * k + 1; ++c) {
+            if(tree[c].max1 > tree[k].max1) apply_chmin(c, tree[k].max1);
+            if(tree[c].min1 < tree[k].min1) apply_chmax(c, tree[k].min1);
+        }
+    }
+    void chmin(int k, int nl, int nr, int l, int r, T a) {
+        if(r <= nl or nr <= l or tree[k].max1 <= a) return;
+        if(l <= nl and nr <= r and tree[k].max2 < a) {
+            apply_chmin(k, a);
+            return;
+        }
+        push(k);
+        int mid = (nl + nr) / 2;
+        chmin(2 * k, nl, mid, l, r, a);
+        chmin(2 * k + 1, mid, nr, l, r, a);
+        update(k);
+    }
+    void chmax(int k, int nl, int nr, int l, int r, T a) {
+        if(r <= nl or nr <= l or tree[k].min1 >= a) return;
+        if(l <= nl and nr <= r and tree[k].min2 > a) {
+            apply_chmax(k, a);
+            return;
+        }
+        push(k);
+        int mid = (nl + nr) / 2;
+        chmax(2 * k, nl, mid, l, r, a);
+        chmax(2 * k + 1, mid, nr, l, r, a);
+        update(k);
+    }
+    void add(int k, int nl, int nr, int l, int r, T a) {
+        if(r <= nl or nr <= l) return;
+        if(l <= nl and nr <= r) {
+            apply_add(k, a);
+            return;
+        }
+        push(k);
+        int mid = (nl + nr) / 2;
+        add(2 * k, nl, mid, l, r, a);
+        add(2 * k + 1, mid, nr, l, r, a);
+        update(k);
+    }
+    // 区間[l,r)を覆う節点に対してf(節点)を左から順に呼び出す．
+    template <class F>
+    void fold(int k, int nl, int nr, int l, int r, const F &f) {
+        if(r <= nl or nr <= l) return;
+        if(l <= nl and nr <= r) {
+            f(tree[k]);
+            return;
+        }
+        push(k);
+        int mid = (nl + nr) / 2;
+        fold(2 * k, nl, mid, l, r, f);
+        fold(2 * k + 1, mid, nr, l, r, f);
+    }
+
+public:
+    // constructor. O(N).
+    SegmentTreeBeats() : SegmentTreeBeats(0) {}
+    explicit SegmentTreeBeats(size_t sz_) : sz(sz_) {
+        build();
+        for(int i = 0; i < sz; ++i) set_leaf(i + n, 0);
+        for(int i = n - 1; i >= 1; --i) update(i);
+    }
+    explicit SegmentTreeBeats(const std::vector<T> &v) : sz(v.size()) {
+        build();
+        for(int i = 0; i < sz; ++i) set_leaf(i + n, v[i]);
+        for(int i = n - 1; i >= 1; --i) update(i);
+    }
+
+    // 要素数を返す．
+    int size() const { return sz; }
+    // k番目の要素をaに置き換える．O(logN).
+    void set(int k, T a) {
+        assert(0 <= k and k < sz);
+        k += n;
+        int depth = 0;
+        while((1 << depth) < n) depth++;
+        for(int i = depth; i >= 1; --i) push(k >> i);
+        set_leaf(k, a);
+        for(int i = 1; i <= depth; ++i) update(k >> i);
+    }
+    // 区間[l,r)の各要素xをmin(x,a)に置き換える．償却O(log^2N).
+    void chmin(int l, int r, T a) {
+        assert(0 <= l and l <= r and r <= sz);
+        chmin(1, 0, n, l, r, a);
+    }
+    // 区間[l,r)の各要素xをmax(x,a)に置き換える．償却O(log^2N).
+    void chmax(int l, int r, T a) {
+        assert(0 <= l and l <= r and r <= sz);
+        chmax(1, 0, n, l, r, a);
+    }
+    // 区間[l,r)の各要素にaを加える．O(logN).
+    void add(int l, int r, T a) {
+        assert(0 <= l and l <= r and r <= sz);
+        add(1, 0, n, l, r, a);
+    }
+    // 一点取得．O(logN).
+    T get(int k) {
+        assert(0 <= k and k < sz);
+        return sum(k, k + 1);
+    }
+    // 区間[l,r)の総和を求める．O(logN).
+    T sum(int l, int r) {
+        assert(0 <= l and l <= r and r <= sz);
+        T res = 0;
+        fold(1, 0, n, l, r, [&](const Node &nd) -> void { res += nd.sum; });
+        return res;
+    }
+    // 区間[l,r)の最小値を求める．区間が空の場合は型の最大値を返す．O(logN).
+    T min(int l, int r) {
+        assert(0 <= l and l <= r and r <= sz);
+        T res = INF;
+        fold(1, 0, n, l, r, [&](const Node &nd) -> void { res = std::min(res, nd.min1); });
+        return res;
+    }
+    // 区間[l,r)の最大値を求める．区間が空の場合は型の最小値を返す．O(logN).
+    T max(int l, int r) {
+        assert(0 <= l and l <= r and r <= sz);
+        T res = NINF;
+        fold(1, 0, n, l, r, [&](const Node &nd) -> void { res = std::max(res, nd.max1); });
+        return res;
+    }
+};
+
+}  // namespace algorithm
+
+#endif
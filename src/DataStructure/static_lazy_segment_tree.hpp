@@ -0,0 +1,367 @@
+#ifndef ALGORITHM_STATIC_LAZY_SEGMENT_TREE_HPP
+#define ALGORITHM_STATIC_LAZY_SEGMENT_TREE_HPP 1
+
+#include <algorithm>  // for copy(), fill(), min() and sort().
+#include <cassert>
+#include <numeric>  // for iota().
+#include <tuple>
+#include <utility>  // for pair.
+#include <vector>
+
+#include "../Others/parallel_for.hpp"
+
+namespace algorithm {
+
+// 演算をテンプレート引数 (ポリシー) として受け取る遅延評価セグメント木．
+// 各演算が関数呼び出しとしてインライン展開される．
+// 取得操作 (prod(), most_right(), most_left()) は遅延評価を伝播せず，祖先の作用素を合成しながら辿るため木を書き換えない．
+// よって更新を行わない間は，複数のスレッドから同時に取得操作を呼び出せる．
+// Policyは次のメンバをもつ型．
+//   using monoid_type = M;
+//   using action_type = A;
+//   static M op(const M &a, const M &b);          // 二項演算．M•M.
+//   static M identity();                         // モノイドの単位元．
+//   static void action(M &a, const A &d);        // 作用素によるモノイド元への作用．M×A.
+//   static void composition(A &d, const A &d2);  // 作用素の合成．A•A.
+//   static A action_identity();                  // 作用素の単位元．
+template <class Policy>
+class StaticLazySegTree {
+public:
+    using monoid_type = typename Policy::monoid_type;
+    using action_type = typename Policy::action_type;
+
+private:
+    using Monoid = monoid_type;
+    using Action = action_type;
+
+    static constexpr int PARALLEL_THRESHOLD = 1 << 14;  // 並列に処理する最小の節点数．
+    static constexpr int MAX_DEPTH = 31;                // 二分木の深さの上限 (要素数はint型で表せる)．
+
+    Policy policy;             // policy:=(演算の集合).
+    Monoid e;                  // e:=(単位元).
+    Action id;                 // id:=(作用素の単位元).
+    int sz;                    // sz:=(要素数).
+    int n;                     // n:=(二分木の葉数).
+    int depth;                 // depth:=(二分木の深さ).
+    std::vector<Monoid> tree;  // tree(2n)[]:=(二分木). 1-based index. 葉数nが2の冪でない場合，完全二分木ではない．
+    std::vector<Action> lazy;  // lazy(n)[k]:=(tree[k]の子 (tree[2k], tree[2k+1]) に対する遅延評価).
+
+    Monoid op(const Monoid &a, const Monoid &b) const { return policy.op(a, b); }
+    void action(Monoid &a, const Action &d) const { policy.action(a, d); }
+    void composition(Action &d, const Action &d2) const { policy.composition(d, d2); }
+    // exact=trueの場合，葉数を2の冪に切り上げず要素数と同じにする．
+    void build(bool exact) {
+        n = 1, depth = 0;
+        if(exact) {
+            if(sz > 1) n = sz;
+        } else {
+            while(n < sz) n <<= 1;
+        }
+        while((2 * n - 1) >> (depth + 1)) depth++;
+        tree.assign(2 * n, e);
+        lazy.assign(n, id);
+    }
+    // 全ての内部節点を子から再計算し，遅延評価を破棄する．節点番号のビット長が等しい節点は互いに独立であるため，段ごとに並列に処理する．
+    void rebuild(int thread_num) {
+        int lo = 1;
+        while(2 * lo < n) lo <<= 1;
+        for(; lo >= 1; lo >>= 1) {
+            const int hi = std::min(2 * lo, n);
+            parallel_for(hi - lo, (hi - lo >= PARALLEL_THRESHOLD ? thread_num : 1), [&](int l, int r) -> void {
+                for(int i = lo + l; i < lo + r; ++i) tree[i] = op(tree[2 * i], tree[2 * i + 1]), lazy[i] = id;
+            });
+        }
+    }
+    bool is_perfect() const { return (n & (n - 1)) == 0; }
+    void apply0(int k, const Action &d) {
+        assert(1 <= k and k < 2 * n);
+        action(tree[k], d);
+        if(k < n) composition(lazy[k], d);
+    }
+    void push(int k) {
+        assert(0 <= k and k < n);
+        if(k == 0) return;  // 葉の深さが一様でない場合，存在しない祖先を指すことがある．
+        apply0(2 * k, lazy[k]);
+        apply0(2 * k + 1, lazy[k]);
+        lazy[k] = id;
+    }
+    void update(int k) {
+        assert(0 <= k and k < n);
+        if(k == 0) return;
+        tree[k] = op(tree[2 * k], tree[2 * k + 1]);
+    }
+    // 節点kがもつ遅延評価を残したまま，子から値を再計算する．
+    void recalc(int k) {
+        assert(0 <= k and k < n);
+        if(k == 0) return;
+        tree[k] = op(tree[2 * k], tree[2 * k + 1]);
+        action(tree[k], lazy[k]);
+    }
+    // 祖先の遅延評価を合成した作用素accを節点kに作用させた値を返す．
+    Monoid value(int k, const Action &acc) const {
+        Monoid res = tree[k];
+        action(res, acc);
+        return res;
+    }
+    // acc[i]:=(節点(k>>i)の全ての祖先がもつ遅延評価を，近い順に合成した作用素) を求める．O(logN).
+    // accは長さdepth+2以上の配列 (MAX_DEPTH+2で足りる)．ヒープ確保を行わない．
+    void pending(int k, Action acc[]) const {
+        assert(depth <= MAX_DEPTH);
+        acc[depth + 1] = id;
+        for(int i = depth; i >= 0; --i) {
+            acc[i] = lazy[k >> (i + 1)];  // lazy[0]は常に単位元．
+            composition(acc[i], acc[i + 1]);
+        }
+    }
+    // 節点kの部分木内でjud(op(val,-))=trueとなる最右位値を二分探索する．accは節点kの祖先がもつ遅延評価．
+    template <class Pred>
+    int search_right(const Pred &jud, int k, Action acc, Monoid &val) const {
+        while(k < n) {
+            Action d = lazy[k];
+            composition(d, acc);
+            acc = d;
+            k *= 2;
+            Monoid &&tmp = op(val, value(k, acc));
+            if(jud(tmp)) val = tmp, k++;
+        }
+        return k - n;
+    }
+    // 節点kの部分木内でjud(op(-,val))=trueとなる最左位値を二分探索する．accは節点kの祖先がもつ遅延評価．
+    template <class Pred>
+    int search_left(const Pred &jud, int k, Action acc, Monoid &val) const {
+        while(k < n) {
+            Action d = lazy[k];
+            composition(d, acc);
+            acc = d;
+            k = 2 * k + 1;
+            Monoid &&tmp = op(value(k, acc), val);
+            if(jud(tmp)) val = tmp, k--;
+        }
+        return k - n + 1;
+    }
+
+public:
+    // constructor. O(N).
+    // exact=trueの場合，葉数を要素数と同じにしてメモリ使用量を抑える (2の冪への切り上げを行わない)．
+    StaticLazySegTree() : StaticLazySegTree(0) {}
+    explicit StaticLazySegTree(size_t sz_, bool exact = false, const Policy &policy_ = Policy())
+        : policy(policy_), e(policy.identity()), id(policy.action_identity()), sz(sz_) {
+        build(exact);
+    }
+    // thread_num>1の場合，構築をthread_num個のスレッドで分担する．O(N/thread_num+logN).
+    explicit StaticLazySegTree(const std::vector<Monoid> &v, bool exact = false, const Policy &policy_ = Policy(), int thread_num = 1)
+        : policy(policy_), e(policy.identity()), id(policy.action_identity()), sz(v.size()) {
+        build(exact);
+        parallel_for(sz, thread_num, [&](int l, int r) -> void { std::copy(v.begin() + l, v.begin() + r, tree.begin() + n + l); });
+        rebuild(thread_num);
+    }
+
+    // 要素数を返す．
+    int size() const { return sz; }
+    // モノイドの単位元を返す．
+    Monoid identity() const { return e; }
+    // 作用素の単位元を返す．
+    Action action_identity() const { return id; }
+    // k番目の要素をaに置き換える．O(logN).
+    void set(int k, const Monoid &a) {
+        assert(0 <= k and k < sz);
+        k += n;
+        for(int i = depth; i >= 1; --i) push(k >> i);
+        tree[k] = a;
+        for(int i = 1; i <= depth; ++i) update(k >> i);
+    }
+    // 区間[l,r)の要素をv[]に置き換える．O(N).
+    void set(int l, int r, const std::vector<Monoid> &v) {
+        assert(0 <= l and l <= r and r <= sz);
+        assert(v.size() == r - l);
+        if(l == r) return;
+        l += n, r += n;
+        for(int i = depth; i >= 1; --i) {
+            int l2 = (l >> i), r2 = ((r - 1) >> i);
+            for(int j = l2; j <= r2; ++j) push(j);  // 区間内の節点がもつ遅延評価も破棄されるよう伝播する．
+        }
+        std::copy(v.begin(), v.end(), tree.begin() + l);
+        for(int i = 1; i <= depth; ++i) {
+            int l2 = (l >> i), r2 = ((r - 1) >> i);
+            for(int j = l2; j <= r2; ++j) update(j);
+        }
+    }
+    // k番目の要素を作用素dを用いて更新する．O(logN).
+    void apply(int k, const Action &d) {
+        assert(0 <= k and k < sz);
+        k += n;
+        for(int i = depth; i >= 1; --i) push(k >> i);
+        action(tree[k], d);
+        for(int i = 1; i <= depth; ++i) update(k >> i);
+    }
+    // 区間[l,r)を作用素dを用いて更新する．O(logN).
+    void apply(int l, int r, const Action &d) {
+        assert(0 <= l and l <= r and r <= sz);
+        if(l == r) return;
+        l += n, r += n;
+        for(int i = depth; i >= 1; --i) {
+            if(((l >> i) << i) != l) push(l >> i);
+            if(((r >> i) << i) != r) push((r - 1) >> i);
+        }
+        for(int l2 = l, r2 = r; l2 < r2; l2 >>= 1, r2 >>= 1) {
+            if(l2 & 1) apply0(l2++, d);
+            if(r2 & 1) apply0(--r2, d);
+        }
+        for(int i = 1; i <= depth; ++i) {
+            if(((l >> i) << i) != l) update(l >> i);
+            if(((r >> i) << i) != r) update((r - 1) >> i);
+        }
+    }
+    // 複数の区間更新をまとめて行う．updates[i]=(l,r,d)について，区間[l,r)を作用素dを用いて順に更新する．O(min(N,QlogN)+QlogN).
+    // 各更新では境界の遅延評価の伝播と作用のみを行い，祖先の値の再計算は最後に1度だけ行う．
+    void apply_batch(const std::vector<std::tuple<int, int, Action> > &updates) {
+        for(const auto &[l, r, d] : updates) {
+            assert(0 <= l and l <= r and r <= sz);
+            if(l == r) continue;
+            const int l2 = l + n, r2 = r + n;
+            for(int i = depth; i >= 1; --i) {
+                if(((l2 >> i) << i) != l2) push(l2 >> i);
+                if(((r2 >> i) << i) != r2) push((r2 - 1) >> i);
+            }
+            for(int l3 = l2, r3 = r2; l3 < r3; l3 >>= 1, r3 >>= 1) {
+                if(l3 & 1) apply0(l3++, d);
+                if(r3 & 1) apply0(--r3, d);
+            }
+        }
+        // 値が古くなりうる節点は，各更新の境界の祖先に限られる．
+        if(2LL * (long long)updates.size() * depth >= n) {
+            for(int k = n - 1; k >= 1; --k) recalc(k);
+            return;
+        }
+        for(int i = 1; i <= depth; ++i) {
+            for(const auto &[l, r, d] : updates) {
+                if(l == r) continue;
+                recalc((l + n) >> i);
+                recalc((r + n - 1) >> i);
+            }
+        }
+    }
+    // 一点取得．O(logN).
+    Monoid prod(int k) const {
+        assert(0 <= k and k < sz);
+        k += n;
+        Monoid res = tree[k];
+        for(int i = 1; i <= depth; ++i) action(res, lazy[k >> i]);
+        return res;
+    }
+    // 区間[l,r)の総積 (v[l]•v[l+1]•....•v[r-1]) を求める．O(logN).
+    Monoid prod(int l, int r) const {
+        assert(0 <= l and l <= r and r <= sz);
+        if(l == r) return e;
+        l += n, r += n;
+        Monoid lv = e, rv = e;
+        bool lf = false, rf = false;  // lf, rf:=(lv, rvが1つ以上の節点を含むか).
+        for(int i = 0, l2 = l, r2 = r; i <= depth; ++i, l2 >>= 1, r2 >>= 1) {
+            // 左側で取り出した節点は全て節点((l-1)>>i)の子孫，右側は節点((r-1)>>i)の子孫であるため，その遅延評価をまとめて作用させる．
+            if(i > 0) {
+                if(lf) action(lv, lazy[(l - 1) >> i]);
+                if(rf) action(rv, lazy[(r - 1) >> i]);
+            }
+            if(l2 < r2) {
+                if(l2 & 1) lv = op(lv, tree[l2++]), lf = true;
+                if(r2 & 1) rv = op(tree[--r2], rv), rf = true;
+            }
+        }
+        return op(lv, rv);
+    }
+    // 区間全体の総積を返す．O(1). ただし葉数が2の冪でない場合はO(logN).
+    Monoid prod_all() const {
+        if(is_perfect()) return tree[1];
+        // 区間全体を覆う節点の祖先は遅延評価をもたないため，伝播は不要．
+        Monoid lv = e, rv = e;
+        for(int l = n, r = sz + n; l < r; l >>= 1, r >>= 1) {
+            if(l & 1) lv = op(lv, tree[l++]);
+            if(r & 1) rv = op(tree[--r], rv);
+        }
+        return op(lv, rv);
+    }
+    // jud(prod(l,-))=trueとなる区間の最右位値を二分探索する．
+    // ただし要素列には単調性があり，またjud(e)=trueであること．O(logN).
+    template <class Pred>
+    int most_right(const Pred &jud, int l) const {
+        assert(jud(e));
+        assert(0 <= l and l <= sz);
+        if(l == sz) return sz;
+        l += n;
+        const int r = sz + n;
+        Action accl[MAX_DEPTH + 2], accr[MAX_DEPTH + 2];
+        pending(l - 1, accl), pending(r - 1, accr);
+        Monoid val = e;
+        int rs[32], hs[32], m = 0;  // rs[]:=(区間の右側から取り出した節点), hs[]:=(その段).
+        for(int i = 0, l2 = l, r2 = r; l2 < r2; ++i, l2 >>= 1, r2 >>= 1) {
+            if(l2 & 1) {
+                Monoid &&tmp = op(val, value(l2, accl[i]));
+                if(!jud(tmp)) return search_right(jud, l2, accl[i], val);
+                val = tmp, l2++;
+            }
+            if(r2 & 1) rs[m] = --r2, hs[m++] = i;
+        }
+        while(m--) {
+            Monoid &&tmp = op(val, value(rs[m], accr[hs[m]]));
+            if(!jud(tmp)) return search_right(jud, rs[m], accr[hs[m]], val);
+            val = tmp;
+        }
+        return sz;
+    }
+    // jud(prod(-,r))=trueとなる区間の最左位値を二分探索する．
+    // ただし要素列には単調性があり，またjud(e)=trueであること．O(logN).
+    template <class Pred>
+    int most_left(const Pred &jud, int r) const {
+        assert(jud(e));
+        assert(0 <= r and r <= sz);
+        if(r == 0) return 0;
+        r += n;
+        const int l = n;
+        Action accl[MAX_DEPTH + 2], accr[MAX_DEPTH + 2];
+        pending(l - 1, accl), pending(r - 1, accr);
+        Monoid val = e;
+        int ls[32], hs[32], m = 0;  // ls[]:=(区間の左側から取り出した節点), hs[]:=(その段).
+        for(int i = 0, l2 = l, r2 = r; l2 < r2; ++i, l2 >>= 1, r2 >>= 1) {
+            if(l2 & 1) ls[m] = l2++, hs[m++] = i;
+            if(r2 & 1) {
+                --r2;
+                Monoid &&tmp = op(value(r2, accr[i]), val);
+                if(!jud(tmp)) return search_left(jud, r2, accr[i], val);
+                val = tmp;
+            }
+        }
+        while(m--) {
+            Monoid &&tmp = op(value(ls[m], accl[hs[m]]), val);
+            if(!jud(tmp)) return search_left(jud, ls[m], accl[hs[m]], val);
+            val = tmp;
+        }
+        return 0;
+    }
+    // 複数の区間積をまとめて求める．res[i]:=prod(queries[i].first, queries[i].second). O(QlogQ+(QlogN)/thread_num).
+    // 取得操作は木を書き換えないため，クエリを区間の左端順に並べ替えてthread_num個のスレッドで分担する．
+    std::vector<Monoid> prod_batch(const std::vector<std::pair<int, int> > &queries, int thread_num = 1) const {
+        const int q = queries.size();
+        std::vector<int> ord(q);
+        std::iota(ord.begin(), ord.end(), 0);
+        std::sort(ord.begin(), ord.end(), [&](int i, int j) -> bool { return queries[i] < queries[j]; });
+        std::vector<Monoid> res(q, e);
+        parallel_for(q, thread_num, [&](int l, int r) -> void {
+            for(int i = l; i < r; ++i) res[ord[i]] = prod(queries[ord[i]].first, queries[ord[i]].second);
+        });
+        return res;
+    }
+    // 全要素をaに置き換える．O(N/thread_num+logN).
+    void fill(const Monoid &a, int thread_num = 1) {
+        parallel_for(sz, thread_num, [&](int l, int r) -> void { std::fill(tree.begin() + n + l, tree.begin() + n + r, a); });
+        rebuild(thread_num);
+    }
+    // 全要素を単位元に戻す．O(N/thread_num).
+    void reset(int thread_num = 1) {
+        parallel_for(2 * n, thread_num, [&](int l, int r) -> void { std::fill(tree.begin() + l, tree.begin() + r, e); });
+        parallel_for(n, thread_num, [&](int l, int r) -> void { std::fill(lazy.begin() + l, lazy.begin() + r, id); });
+    }
+};
+
+}  // namespace algorithm
+
+#endif
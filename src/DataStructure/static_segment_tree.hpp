@@ -0,0 +1,242 @@
+#ifndef ALGORITHM_STATIC_SEGMENT_TREE_HPP
+#define ALGORITHM_STATIC_SEGMENT_TREE_HPP 1
+
+#include <algorithm>  // for copy(), fill(), min() and sort().
+#include <cassert>
+#include <numeric>  // for iota().
+#include <utility>  // for pair.
+#include <vector>
+
+#include "../Others/parallel_for.hpp"
+
+namespace algorithm {
+
+// 演算をテンプレート引数 (ポリシー) として受け取るセグメント木．
+// 二項演算や判定関数が関数呼び出しとしてインライン展開される．
+// Monoidは次のメンバをもつ型．
+//   using value_type = T;
+//   static T op(const T &a, const T &b);  // 二項演算．
+//   static T identity();                 // 単位元．
+template <class Monoid>
+class StaticSegmentTree {
+public:
+    using value_type = typename Monoid::value_type;
+
+private:
+    using T = value_type;
+
+    static constexpr int PARALLEL_THRESHOLD = 1 << 14;  // 並列に処理する最小の節点数．
+
+    Monoid monoid;        // monoid:=(モノイド). 演算op()と単位元identity()をもつ．
+    T e;                  // e:=(単位元).
+    int sz;               // sz:=(要素数).
+    int n;                // n:=(葉の数).
+    std::vector<T> tree;  // tree[]:=(二分木). 1-based index. 葉数nが2の冪でない場合，完全二分木ではない．
+
+    T op(const T &a, const T &b) const { return monoid.op(a, b); }
+    // exact=trueの場合，葉数を2の冪に切り上げず要素数と同じにする．
+    void build(bool exact) {
+        n = 1;
+        if(exact) {
+            if(sz > 1) n = sz;
+        } else {
+            while(n < sz) n <<= 1;
+        }
+        tree.assign(2 * n, e);
+    }
+    // 全ての内部節点を子から再計算する．節点番号のビット長が等しい節点は互いに独立であるため，段ごとに並列に処理する．
+    void rebuild(int thread_num) {
+        int lo = 1;
+        while(2 * lo < n) lo <<= 1;
+        for(; lo >= 1; lo >>= 1) {
+            const int hi = std::min(2 * lo, n);
+            parallel_for(hi - lo, (hi - lo >= PARALLEL_THRESHOLD ? thread_num : 1), [&](int l, int r) -> void {
+                for(int i = lo + l; i < lo + r; ++i) tree[i] = op(tree[i << 1], tree[(i << 1) | 1]);
+            });
+        }
+    }
+    bool is_perfect() const { return (n & (n - 1)) == 0; }
+    // 節点kの部分木内でjud(op(val,-))=trueとなる最右位値を二分探索する．
+    template <class Pred>
+    int search_right(const Pred &jud, int k, T &val) const {
+        while(k < n) {
+            k <<= 1;
+            T &&tmp = op(val, tree[k]);
+            if(jud(tmp)) val = tmp, k++;
+        }
+        return k - n;
+    }
+    // 節点kの部分木内でjud(op(-,val))=trueとなる最左位値を二分探索する．
+    template <class Pred>
+    int search_left(const Pred &jud, int k, T &val) const {
+        while(k < n) {
+            k = (k << 1) | 1;
+            T &&tmp = op(tree[k], val);
+            if(jud(tmp)) val = tmp, k--;
+        }
+        return k - n + 1;
+    }
+
+public:
+    // constructor. O(N).
+    // exact=trueの場合，葉数を要素数と同じにしてメモリ使用量を抑える (2の冪への切り上げを行わない)．
+    StaticSegmentTree() : StaticSegmentTree(0) {}
+    explicit StaticSegmentTree(size_t sz_, bool exact = false, const Monoid &monoid_ = Monoid())
+        : monoid(monoid_), e(monoid.identity()), sz(sz_) {
+        build(exact);
+    }
+    // thread_num>1の場合，構築をthread_num個のスレッドで分担する．O(N/thread_num+logN).
+    explicit StaticSegmentTree(const std::vector<T> &v, bool exact = false, const Monoid &monoid_ = Monoid(), int thread_num = 1)
+        : monoid(monoid_), e(monoid.identity()), sz(v.size()) {
+        build(exact);
+        parallel_for(sz, thread_num, [&](int l, int r) -> void { std::copy(v.begin() + l, v.begin() + r, tree.begin() + n + l); });
+        rebuild(thread_num);
+    }
+
+    // 要素数を返す．
+    int size() const { return sz; }
+    // 単位元を返す．
+    T identity() const { return e; }
+    // k番目の要素をaに置き換える．O(logN).
+    void set(int k, const T &a) {
+        assert(0 <= k and k < sz);
+        k += n;
+        tree[k] = a;
+        while(k >>= 1) tree[k] = op(tree[k << 1], tree[(k << 1) | 1]);
+    }
+    // k番目の要素をaを加える．O(logN).
+    void add(int k, const T &a) {
+        assert(0 <= k and k < sz);
+        k += n;
+        tree[k] += a;
+        while(k >>= 1) tree[k] = op(tree[k << 1], tree[(k << 1) | 1]);
+    }
+    // 一点取得．O(1).
+    T prod(int k) const {
+        assert(0 <= k and k < sz);
+        return tree[k + n];
+    }
+    // 区間[l,r)の総積（v[l]•v[l+1]•....•v[r-1]）を求める．O(logN).
+    T prod(int l, int r) const {
+        assert(0 <= l and l <= r and r <= sz);
+        T lv = e, rv = e;
+        l += n, r += n;
+        while(l < r) {
+            if(l & 1) lv = op(lv, tree[l++]);
+            if(r & 1) rv = op(tree[--r], rv);
+            l >>= 1, r >>= 1;
+        }
+        return op(lv, rv);
+    }
+    // 区間全体の総積を返す．O(1). ただし葉数が2の冪でない場合はO(logN).
+    T prod_all() const { return (is_perfect() ? tree[1] : prod(0, sz)); }
+    // jud(prod(l,-))=trueとなる区間の最右位値を二分探索する．
+    // ただし要素列には単調性があり，またjud(e)=trueであること．O(logN).
+    template <class Pred>
+    int most_right(const Pred &jud, int l) const {
+        assert(jud(e) == true);
+        assert(0 <= l and l <= sz);
+        if(l == sz) return sz;
+        T val = e;
+        if(!is_perfect()) {
+            int rs[32], m = 0;  // rs[]:=(区間の右側から取り出した節点).
+            for(int r = sz + n, l2 = l + n; l2 < r; l2 >>= 1, r >>= 1) {
+                if(l2 & 1) {
+                    T &&tmp = op(val, tree[l2]);
+                    if(!jud(tmp)) return search_right(jud, l2, val);
+                    val = tmp, l2++;
+                }
+                if(r & 1) rs[m++] = --r;
+            }
+            while(m--) {
+                T &&tmp = op(val, tree[rs[m]]);
+                if(!jud(tmp)) return search_right(jud, rs[m], val);
+                val = tmp;
+            }
+            return sz;
+        }
+        l += n;
+        do {
+            while(!(l & 1)) l >>= 1;
+            T &&tmp = op(val, tree[l]);
+            if(!jud(tmp)) return search_right(jud, l, val);
+            val = tmp, l++;
+        } while((l & -l) != l);  // (x&-x)==xのとき，xは2の階乗数．
+        return sz;
+    }
+    // jud(prod(-,r))=trueとなる区間の最左位値を二分探索する．
+    // ただし要素列には単調性があり，またjud(e)=trueであること．O(logN).
+    template <class Pred>
+    int most_left(const Pred &jud, int r) const {
+        assert(jud(e) == true);
+        assert(0 <= r and r <= sz);
+        if(r == 0) return 0;
+        T val = e;
+        if(!is_perfect()) {
+            int ls[32], m = 0;  // ls[]:=(区間の左側から取り出した節点).
+            for(int l = n, r2 = r + n; l < r2; l >>= 1, r2 >>= 1) {
+                if(l & 1) ls[m++] = l++;
+                if(r2 & 1) {
+                    T &&tmp = op(tree[--r2], val);
+                    if(!jud(tmp)) return search_left(jud, r2, val);
+                    val = tmp;
+                }
+            }
+            while(m--) {
+                T &&tmp = op(tree[ls[m]], val);
+                if(!jud(tmp)) return search_left(jud, ls[m], val);
+                val = tmp;
+            }
+            return 0;
+        }
+        r += n;
+        do {
+            r--;
+            while(r > 1 and r & 1) r >>= 1;
+            T &&tmp = op(tree[r], val);
+            if(!jud(tmp)) return search_left(jud, r, val);
+            val = tmp;
+        } while((r & -r) != r);  // (x&-x)==xのとき，xは2の階乗数．
+        return 0;
+    }
+    // 複数の区間積をまとめて求める．res[i]:=prod(queries[i].first, queries[i].second). O(QlogQ+(QlogN)/thread_num).
+    // クエリを区間の左端順に並べ替えて参照の局所性を高め，thread_num個のスレッドで分担する．
+    std::vector<T> prod_batch(const std::vector<std::pair<int, int> > &queries, int thread_num = 1) const {
+        const int q = queries.size();
+        std::vector<int> ord(q);
+        std::iota(ord.begin(), ord.end(), 0);
+        std::sort(ord.begin(), ord.end(), [&](int i, int j) -> bool { return queries[i] < queries[j]; });
+        std::vector<T> res(q, e);
+        parallel_for(q, thread_num, [&](int l, int r) -> void {
+            for(int i = l; i < r; ++i) res[ord[i]] = prod(queries[ord[i]].first, queries[ord[i]].second);
+        });
+        return res;
+    }
+    // 複数の左端に対してmost_right()をまとめて求める．res[i]:=most_right(jud, ls[i]). O(QlogQ+(QlogN)/thread_num).
+    // judは複数のスレッドから同時に呼び出される．
+    template <class Pred>
+    std::vector<int> most_right_batch(const Pred &jud, const std::vector<int> &ls, int thread_num = 1) const {
+        const int q = ls.size();
+        std::vector<int> ord(q);
+        std::iota(ord.begin(), ord.end(), 0);
+        std::sort(ord.begin(), ord.end(), [&](int i, int j) -> bool { return ls[i] < ls[j]; });
+        std::vector<int> res(q);
+        parallel_for(q, thread_num, [&](int l, int r) -> void {
+            for(int i = l; i < r; ++i) res[ord[i]] = most_right(jud, ls[ord[i]]);
+        });
+        return res;
+    }
+    // 全要素をaに置き換える．O(N/thread_num+logN).
+    void fill(const T &a, int thread_num = 1) {
+        parallel_for(sz, thread_num, [&](int l, int r) -> void { std::fill(tree.begin() + n + l, tree.begin() + n + r, a); });
+        rebuild(thread_num);
+    }
+    // 全要素を単位元に戻す．O(N/thread_num).
+    void reset(int thread_num = 1) {
+        parallel_for(2 * n, thread_num, [&](int l, int r) -> void { std::fill(tree.begin() + l, tree.begin() + r, e); });
+    }
+};
+
+}  // namespace algorithm
+
+#endif
@@ -0,0 +1,220 @@
+#ifndef ALGORITHM_WAVELET_MATRIX_HPP
+#define ALGORITHM_WAVELET_MATRIX_HPP 1
+
+#include <algorithm>  // for stable_partition().
+#include <cassert>
+#include <cstdint>
+#include <queue>
+#include <tuple>
+#include <utility>  // for pair.
+#include <vector>
+
+namespace algorithm {
+
+// 完備辞書 (Succinct Bit Vector)．
+// 64bitごとのブロックに先頭からの1の個数を記録し，rankをO(1)で求める．
+class BitVector {
+    int sz;                      // sz:=(ビット長).
+    std::vector<uint64_t> bits;  // bits[]:=(ビット列).
+    std::vector<int> acc;        // acc[i]:=(bits[0:i]に含まれる1の個数).
+
+    static int popcount(uint64_t x) { return __builtin_popcountll(x); }
+
+public:
+    // constructor.
+    BitVector() : BitVector(0) {}
+    explicit BitVector(int n) : sz(n), bits((n >> 6) + 1, 0), acc((n >> 6) + 2, 0) {
+        assert(n >= 0);
+    }
+
+    // ビット長を返す．
+    int size() const { return sz; }
+    // k番目のビットを取得する．O(1).
+    bool operator[](int k) const {
+        assert(0 <= k and k < sz);
+        return (bits[k >> 6] >> (k & 63)) & 1ULL;
+    }
+
+    // k番目のビットを1にする．build()前に限る．O(1).
+    void set(int k) {
+        assert(0 <= k and k < sz);
+        bits[k >> 6] |= 1ULL << (k & 63);
+    }
+    // rankのための補助配列を構築する．O(N/64).
+    void build() {
+        for(int i = 0; i < (int)bits.size(); ++i) acc[i + 1] = acc[i] + popcount(bits[i]);
+    }
+    // 区間[0,r)に含まれる1の個数を求める．O(1).
+    int rank1(int r) const {
+        assert(0 <= r and r <= sz);
+        return acc[r >> 6] + popcount(bits[r >> 6] & ((1ULL << (r & 63)) - 1));
+    }
+    // 区間[0,r)に含まれる0の個数を求める．O(1).
+    int rank0(int r) const { return r - rank1(r); }
+    // 区間[0,r)に含まれるbの個数を求める．O(1).
+    int rank(bool b, int r) const { return (b ? rank1(r) : rank0(r)); }
+    // k番目 (0-based) のビットbの位置を求める．存在しない場合は-1を返す．O(logN).
+    int select(bool b, int k) const {
+        assert(k >= 0);
+        if(rank(b, sz) <= k) return -1;
+        // ブロック [0,ok) に含まれるbの個数がk以下となる最大のokを二分探索する．
+        auto cnt = [&](int i) -> int { return (b ? acc[i] : 64 * i - acc[i]); };
+        int ok = 0, ng = bits.size();
+        while(ng - ok > 1) {
+            int mid = (ok + ng) / 2;
+            (cnt(mid) <= k ? ok : ng) = mid;
+        }
+        k -= cnt(ok);
+        uint64_t w = (b ? bits[ok] : ~bits[ok]);
+        for(int i = 0;; ++i) {
+            if(((w >> i) & 1ULL) and k-- == 0) return 64 * ok + i;
+        }
+    }
+};
+
+// Wavelet Matrix．
+// 非負整数値の静的な数列に対し，区間[l,r)のk番目の値や値x未満の要素数などを求める．
+// 値の各ビットについて，上位から順に安定ソートしたときのビット列をBitVectorで保持する．
+// 記憶域は約N*B*(1+32/64)ビット．各段のビット列に加え，rank用に64ビットごとにint型の累積値をもつ．
+template <typename T = unsigned, int B = 32>  // T:データ型, B:ビット長.
+class WaveletMatrix {
+    int sz;                      // sz:=(要素数).
+    std::vector<BitVector> mat;  // mat[i]:=(上位からi番目のビットの段).
+    std::vector<int> mid;        // mid[i]:=(段iのビット列に含まれる0の個数).
+
+    // 値xの上位からi番目のビットを返す．
+    static bool bit(T x, int i) { return (x >> (B - 1 - i)) & (T)1; }
+    // 値xがBビットで表せないかどうか．
+    static bool is_wide(T x) { return (x >> (B - 1) >> 1) != 0; }
+    // 段iの位置kを，ビットbに従って次の段の位置に移す．O(1).
+    int next(int i, bool b, int k) const { return (b ? mid[i] + mat[i].rank1(k) : mat[i].rank0(k)); }
+
+public:
+    // constructor. O(N*B).
+    WaveletMatrix() : WaveletMatrix(std::vector<T>()) {}
+    explicit WaveletMatrix(std::vector<T> v) : sz(v.size()), mat(B, BitVector(sz)), mid(B) {
+        static_assert(B >= 1);
+        for(int k = 0; k < sz; ++k) assert(!is_wide(v[k]));
+        for(int i = 0; i < B; ++i) {
+            for(int k = 0; k < sz; ++k) {
+                if(bit(v[k], i)) mat[i].set(k);
+            }
+            mat[i].build();
+            mid[i] = mat[i].rank0(sz);
+            std::stable_partition(v.begin(), v.end(), [&](const T &x) -> bool { return !bit(x, i); });
+        }
+    }
+
+    // 要素数を返す．
+    int size() const { return sz; }
+    // k番目の要素を取得する．O(B).
+    T operator[](int k) const {
+        assert(0 <= k and k < sz);
+        T res = 0;
+        for(int i = 0; i < B; ++i) {
+            bool b = mat[i][k];
+            if(b) res |= (T)1 << (B - 1 - i);
+            k = next(i, b, k);
+        }
+        return res;
+    }
+
+    // 区間[0,r)に含まれる値xの個数を求める．O(B).
+    int rank(T x, int r) const {
+        assert(0 <= r and r <= sz);
+        if(is_wide(x)) return 0;
+        int l = 0;
+        for(int i = 0; i < B; ++i) {
+            bool b = bit(x, i);
+            l = next(i, b, l), r = next(i, b, r);
+        }
+        return r - l;
+    }
+    // k番目 (0-based) の値xの位置を求める．存在しない場合は-1を返す．O(B*logN).
+    int select(T x, int k) const {
+        assert(k >= 0);
+        if(rank(x, sz) <= k) return -1;
+        // 最下段での値xの区間の先頭を求め，各段のselectで上に戻る．
+        int p = 0;
+        for(int i = 0; i < B; ++i) p = next(i, bit(x, i), p);
+        p += k;
+        for(int i = B - 1; i >= 0; --i) {
+            bool b = bit(x, i);
+            p = mat[i].select(b, (b ? p - mid[i] : p));
+        }
+        return p;
+    }
+    // 区間[l,r)のうち，値がx未満の要素数を求める．O(B).
+    int count_less(int l, int r, T x) const {
+        assert(0 <= l and l <= r and r <= sz);
+        if(is_wide(x)) return r - l;  // 全要素がx未満となる．
+        int res = 0;
+        for(int i = 0; i < B and l < r; ++i) {
+            bool b = bit(x, i);
+            if(b) res += mat[i].rank0(r) - mat[i].rank0(l);
+            l = next(i, b, l), r = next(i, b, r);
+        }
+        return res;
+    }
+    // 区間[l,r)のうち，値が[lower,upper)に含まれる要素数を求める．O(B).
+    int count(int l, int r, T lower, T upper) const {
+        assert(0 <= l and l <= r and r <= sz);
+        if(!(lower < upper)) return 0;
+        return count_less(l, r, upper) - count_less(l, r, lower);
+    }
+    // 区間[l,r)の要素のうち，小さい方からk番目 (0-based) の値を求める．O(B).
+    T kth_smallest(int l, int r, int k) const {
+        assert(0 <= l and l <= r and r <= sz);
+        assert(0 <= k and k < r - l);
+        T res = 0;
+        for(int i = 0; i < B; ++i) {
+            int zeros = mat[i].rank0(r) - mat[i].rank0(l);
+            bool b = (k >= zeros);
+            if(b) {
+                k -= zeros;
+                res |= (T)1 << (B - 1 - i);
+            }
+            l = next(i, b, l), r = next(i, b, r);
+        }
+        return res;
+    }
+    // 区間[l,r)の要素のうち，大きい方からk番目 (0-based) の値を求める．O(B).
+    T kth_largest(int l, int r, int k) const {
+        assert(0 <= l and l <= r and r <= sz);
+        assert(0 <= k and k < r - l);
+        return kth_smallest(l, r, r - l - k - 1);
+    }
+    // 区間[l,r)に出現する値のうち，出現回数の多い順に高々k種類の (値, 出現回数) を求める．
+    // 要素数がk番目の答えの出現回数より多い部分木は全て展開されるため，k=1でも最悪で区間内の値の種類数に比例する節点を訪れる．
+    // 区間[l,r)の値の種類数をMとして，最悪O(M*B*log(M*B))．出現回数に偏りがある場合は高速．
+    std::vector<std::pair<T, int> > top_k(int l, int r, int k) const {
+        assert(0 <= l and l <= r and r <= sz);
+        assert(k >= 0);
+        std::vector<std::pair<T, int> > res;
+        // 要素数の多い部分木から順に探索する．
+        std::priority_queue<std::tuple<int, int, int, int, T> > pque;  // (要素数, 段, l, r, 値の上位ビット).
+        if(l < r) pque.emplace(r - l, 0, l, r, 0);
+        while(!pque.empty() and (int)res.size() < k) {
+            auto [w, i, nl, nr, x] = pque.top();
+            pque.pop();
+            if(i == B) {
+                res.emplace_back(x, w);
+                continue;
+            }
+            for(int b = 0; b < 2; ++b) {
+                int ll = next(i, b, nl), rr = next(i, b, nr);
+                if(ll < rr) pque.emplace(rr - ll, i + 1, ll, rr, x | ((T)b << (B - 1 - i)));
+            }
+        }
+        return res;
+    }
+};
+
+}  // namespace algorithm
+
+#endif
+
+/**
+ * 参考文献
+ * - Francisco Claude, Gonzalo Navarro, Alberto Ordóñez, The wavelet matrix, Information Systems, vol.47, pp.15-32, 2015.
+ */
@@ -0,0 +1,252 @@
+#ifndef ALGORITHM_WIDE_SEGMENT_TREE_HPP
+#define ALGORITHM_WIDE_SEGMENT_TREE_HPP 1
+
+#include <algorithm>  // for max() and min().
+#include <cassert>
+#include <vector>
+
+namespace algorithm {
+
+// B分木のセグメント木 (S-tree)．
+// 各節点はB個の子の値と，その累積積 (左から・右から) をキャッシュライン境界に揃えて保持する．
+// 木の高さがlog_B(N)となり，区間積の取得では各段で高々2回の読み出しで済むため，二分木に比べてキャッシュミスが少ない．
+// 節点内の走査は固定長のループであり，算術型の演算ではコンパイラによりSIMD命令へ自動ベクトル化される．
+// MonoidはStaticSegmentTreeと同じ形式の型．
+// 分岐数Bには，B*sizeof(value_type)が64の倍数となる2以上の値を指定できる．
+// 既定値はその条件を満たし，かつ節点内の各配列が128バイト以上となる最小の値．
+constexpr int wide_segment_tree_default_branch(int size) {
+    int b = 1;
+    while((b * size) % 64 != 0 or b * size < 128) b++;
+    return (b >= 2 ? b : 2);
+}
+
+template <class Monoid, int B = wide_segment_tree_default_branch(sizeof(typename Monoid::value_type))>  // B:=(分岐数).
+class WideSegmentTree {
+public:
+    using value_type = typename Monoid::value_type;
+
+private:
+    using T = value_type;
+
+    static_assert(B >= 2);
+    static_assert((B * sizeof(T)) % 64 == 0, "B*sizeof(value_type) must be a multiple of 64");
+
+    struct alignas(64) Node {
+        T val[B];  // val[i]:=(i番目の子の値). 範囲外は単位元で埋める．
+        T pre[B];  // pre[i]:=val[0]•val[1]•...•val[i].
+        T suf[B];  // suf[i]:=val[i]•val[i+1]•...•val[B-1].
+    };
+
+    Monoid monoid;            // monoid:=(モノイド). 演算op()と単位元identity()をもつ．
+    T e;                      // e:=(単位元).
+    int sz;                   // sz:=(要素数).
+    int height;               // height:=(木の高さ). 最上位の段は1つの節点からなる．
+    std::vector<int> cnt;     // cnt[h]:=(h段目の値の数). 0段目が葉．
+    std::vector<int> offset;  // offset[h]:=(h段目の先頭の節点番号).
+    std::vector<Node> nodes;  // nodes[]:=(全ての段の節点). 各段は連続に並ぶ．
+
+    T op(const T &a, const T &b) const { return monoid.op(a, b); }
+    Node &node(int h, int k) { return nodes[offset[h] + k / B]; }
+    const Node &node(int h, int k) const { return nodes[offset[h] + k / B]; }
+    void build() {
+        cnt.assign(1, sz);
+        offset.assign(1, 0);
+        int total = 0;
+        while(1) {
+            int m = std::max((cnt.back() + B - 1) / B, 1);
+            total += m;
+            if(m == 1) break;
+            cnt.push_back(m);
+            offset.push_back(total);
+        }
+        height = cnt.size();
+        Node init;
+        for(int i = 0; i < B; ++i) init.val[i] = init.pre[i] = init.suf[i] = e;
+        nodes.assign(total, init);
+    }
+    // 節点の累積積を計算する．O(B).
+    void calc(Node &nd) const {
+        nd.pre[0] = nd.val[0];
+        for(int j = 1; j < B; ++j) nd.pre[j] = op(nd.pre[j - 1], nd.val[j]);
+        nd.suf[B - 1] = nd.val[B - 1];
+        for(int j = B - 2; j >= 0; --j) nd.suf[j] = op(nd.val[j], nd.suf[j + 1]);
+    }
+    // 節点のi番目の子が変化したとき，累積積を再計算する．O(B).
+    void calc(Node &nd, int i) const {
+        nd.pre[i] = (i == 0 ? nd.val[0] : op(nd.pre[i - 1], nd.val[i]));
+        for(int j = i + 1; j < B; ++j) nd.pre[j] = op(nd.pre[j - 1], nd.val[j]);
+        nd.suf[i] = (i == B - 1 ? nd.val[B - 1] : op(nd.val[i], nd.suf[i + 1]));
+        for(int j = i - 1; j >= 0; --j) nd.suf[j] = op(nd.val[j], nd.suf[j + 1]);
+    }
+    // h段目の区間[l,r)の総積を求める．ただし区間は同じ節点に含まれること．O(B).
+    T fold(int h, int l, int r) const {
+        assert(l < r and l / B == (r - 1) / B);
+        const T *p = node(h, l).val;
+        const int lo = l % B, hi = lo + (r - l);
+        T res = e;
+        for(int i = 0; i < B; ++i) res = op(res, (lo <= i and i < hi) ? p[i] : e);  // 分岐を含まない固定長のループとし，ベクトル化させる．
+        return res;
+    }
+    // 葉kを含む節点とその祖先を更新する．O(B*log_B(N)).
+    void update(int k) {
+        for(int h = 0;; ++h) {
+            Node &nd = node(h, k);
+            calc(nd, k % B);
+            if(h == height - 1) return;
+            k /= B;
+            node(h + 1, k).val[k % B] = nd.pre[B - 1];
+        }
+    }
+    // h段目の節点kの子のうち，jud(op(val,pre[i]))=falseとなる最小のiを求め，葉まで降りる．O(log(B)*log_B(N)).
+    template <class Pred>
+    int search_right(const Pred &jud, int h, int k, T &val) const {
+        while(h > 0) {
+            h--;
+            const Node &nd = nodes[offset[h] + k];
+            int ng = -1, ok = B - 1;  // 累積積は単調であるため二分探索できる．
+            while(ok - ng > 1) {
+                int mid = (ng + ok) / 2;
+                (jud(op(val, nd.pre[mid])) ? ng : ok) = mid;
+            }
+            if(ok > 0) val = op(val, nd.pre[ok - 1]);
+            k = k * B + ok;
+        }
+        return k;
+    }
+    // h段目の節点kの子のうち，jud(op(suf[i],val))=falseとなる最大のiを求め，葉まで降りる．O(log(B)*log_B(N)).
+    template <class Pred>
+    int search_left(const Pred &jud, int h, int k, T &val) const {
+        while(h > 0) {
+            h--;
+            const Node &nd = nodes[offset[h] + k];
+            int ok = 0, ng = B;
+            while(ng - ok > 1) {
+                int mid = (ok + ng) / 2;
+                (jud(op(nd.suf[mid], val)) ? ng : ok) = mid;
+            }
+            if(ok < B - 1) val = op(nd.suf[ok + 1], val);
+            k = k * B + ok;
+        }
+        return k + 1;
+    }
+
+public:
+    // constructor. O(N).
+    WideSegmentTree() : WideSegmentTree(0) {}
+    explicit WideSegmentTree(size_t sz_, const Monoid &monoid_ = Monoid())
+        : monoid(monoid_), e(monoid.identity()), sz(sz_) {
+        build();
+    }
+    explicit WideSegmentTree(const std::vector<T> &v, const Monoid &monoid_ = Monoid())
+        : monoid(monoid_), e(monoid.identity()), sz(v.size()) {
+        build();
+        for(int i = 0; i < sz; ++i) node(0, i).val[i % B] = v[i];
+        for(int h = 0; h < height; ++h) {
+            const int m = (h == height - 1 ? 1 : cnt[h + 1]);
+            for(int k = 0; k < m; ++k) {
+                Node &nd = nodes[offset[h] + k];
+                calc(nd);
+                if(h < height - 1) node(h + 1, k).val[k % B] = nd.pre[B - 1];
+            }
+        }
+    }
+
+    // 要素数を返す．
+    int size() const { return sz; }
+    // 単位元を返す．
+    T identity() const { return e; }
+    // k番目の要素をaに置き換える．O(B*log_B(N)).
+    void set(int k, const T &a) {
+        assert(0 <= k and k < sz);
+        node(0, k).val[k % B] = a;
+        update(k);
+    }
+    // k番目の要素をaを加える．O(B*log_B(N)).
+    void add(int k, const T &a) {
+        assert(0 <= k and k < sz);
+        node(0, k).val[k % B] += a;
+        update(k);
+    }
+    // 一点取得．O(1).
+    T prod(int k) const {
+        assert(0 <= k and k < sz);
+        return node(0, k).val[k % B];
+    }
+    // 区間[l,r)の総積（v[l]•v[l+1]•....•v[r-1]）を求める．O(log_B(N)+B).
+    T prod(int l, int r) const {
+        assert(0 <= l and l <= r and r <= sz);
+        T lv = e, rv = e;
+        for(int h = 0; l < r; ++h) {
+            int bl = l / B, br = r / B;
+            if(bl == br or h == height - 1) return op(op(lv, fold(h, l, r)), rv);
+            if(l % B != 0) lv = op(lv, node(h, l).suf[l % B]), bl++;
+            if(r % B != 0) rv = op(node(h, r).pre[r % B - 1], rv);
+            l = bl, r = br;
+        }
+        return op(lv, rv);
+    }
+    // 区間全体の総積を返す．O(1).
+    T prod_all() const { return nodes.back().pre[B - 1]; }
+    // jud(prod(l,-))=trueとなる区間の最右位値を探索する．
+    // ただし要素列には単調性があり，またjud(e)=trueであること．O(log(B)*log_B(N)).
+    template <class Pred>
+    int most_right(const Pred &jud, int l) const {
+        assert(jud(e) == true);
+        assert(0 <= l and l <= sz);
+        if(l == sz) return sz;
+        T val = e;
+        int h = 0, k = l;
+        while(1) {
+            const Node &nd = node(h, k);
+            T &&tmp = op(val, nd.suf[k % B]);
+            if(!jud(tmp)) break;
+            val = tmp;
+            if(h == height - 1) return sz;
+            h++, k = k / B + 1;
+            if(k == cnt[h]) return sz;
+        }
+        // 節点内でjud()がfalseとなる最初の子を探す．
+        const Node &nd = node(h, k);
+        for(;; ++k) {
+            T &&tmp = op(val, nd.val[k % B]);
+            if(!jud(tmp)) break;
+            val = tmp;
+        }
+        return search_right(jud, h, k, val);
+    }
+    // jud(prod(-,r))=trueとなる区間の最左位値を探索する．
+    // ただし要素列には単調性があり，またjud(e)=trueであること．O(log(B)*log_B(N)).
+    template <class Pred>
+    int most_left(const Pred &jud, int r) const {
+        assert(jud(e) == true);
+        assert(0 <= r and r <= sz);
+        if(r == 0) return 0;
+        T val = e;
+        int h = 0, k = r - 1;
+        while(1) {
+            const Node &nd = node(h, k);
+            T &&tmp = op(nd.pre[k % B], val);
+            if(!jud(tmp)) break;
+            val = tmp;
+            if(h == height - 1) return 0;
+            h++, k = k / B - 1;
+            if(k < 0) return 0;
+        }
+        const Node &nd = node(h, k);
+        for(;; --k) {
+            T &&tmp = op(nd.val[k % B], val);
+            if(!jud(tmp)) break;
+            val = tmp;
+        }
+        return search_left(jud, h, k, val);
+    }
+    void reset() {
+        for(Node &nd : nodes) {
+            for(int i = 0; i < B; ++i) nd.val[i] = nd.pre[i] = nd.suf[i] = e;
+        }
+    }
+};
+
+}  // namespace algorithm
+
+#endif
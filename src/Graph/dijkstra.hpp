@@ -8,6 +8,8 @@
 #include <utility>     // for pair.
 #include <vector>
 
+#include "../DataStructure/indexed_heap.hpp"
+
 namespace algorithm {
 
 template <typename T>
@@ -23,12 +25,13 @@ class Dijkstra {
     std::vector<std::vector<Edge> > m_g;  // m_g[v][]:=(ノードvが始点である有向辺のリスト).
     std::vector<T> m_d;                   // m_d[t]:=(ノードsからtへの最短距離).
     std::vector<int> m_pre;               // m_pre[t]:=(ノードtを訪問する直前のノード番号). 逆方向経路．
+    IndexedHeap<T> m_heap;                // m_heap:=(添字付きヒープ). dijkstra()で再利用する．
     T m_inf;
 
 public:
     // constructor.
     Dijkstra() : Dijkstra(0) {}
-    explicit Dijkstra(size_t vn, T inf = 1e9) : m_vn(vn), m_g(vn), m_d(vn, inf), m_pre(vn, -1), m_inf(inf) {}
+    explicit Dijkstra(size_t vn, T inf = 1e9) : m_vn(vn), m_g(vn), m_d(vn, inf), m_pre(vn, -1), m_heap(vn), m_inf(inf) {}
 
     // ノード数を返す．
     int size() const { return m_vn; }
@@ -40,11 +43,26 @@ public:
         m_g[from].push_back((Edge){to, cost});
     }
     // ノードsから各ノードへの最短距離を求める．O(|E|*log|V|).
-    void dijkstra(int s) {
+    // indexed=trueの場合，優先度付きキューの代わりにIndexedHeapでキーを減少させ，キューの大きさを|V|以下に抑える．
+    void dijkstra(int s, bool indexed = false) {
         assert(0 <= s and s < m_vn);
         std::fill(m_d.begin(), m_d.end(), m_inf);
         m_d[s] = 0;
         std::fill(m_pre.begin(), m_pre.end(), -1);
+        if(indexed) {
+            m_heap.push_or_decrease(0, s);
+            while(!m_heap.empty()) {
+                auto [dist, v] = m_heap.pop_min();
+                for(const Edge &e : m_g[v]) {
+                    if(m_d[e.to] > dist + e.cost) {
+                        m_d[e.to] = dist + e.cost;
+                        m_pre[e.to] = v;
+                        m_heap.push_or_decrease(m_d[e.to], e.to);
+                    }
+                }
+            }
+            return;
+        }
         r_priority_queue<std::pair<T, int> > pque;
         pque.emplace(0, s);
         while(!pque.empty()) {
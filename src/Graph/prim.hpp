@@ -1,11 +1,11 @@
 #ifndef ALGORITHM_PRIM_HPP
 #define ALGORITHM_PRIM_HPP 1
 
-#include <algorithm>
 #include <cassert>
-#include <utility>
 #include <vector>
 
+#include "../DataStructure/indexed_heap.hpp"
+
 namespace algorithm {
 
 template <typename T>
@@ -15,38 +15,15 @@ class Prim {
         T cost;
     };
 
-    int m_vn;                                // m_vn:=(ノード数).
-    int m_n;                                 // m_n:=(葉の数).
-    std::vector<std::vector<Edge> > m_g;     // m_g[v][]:=(ノードvがもつ辺のリスト).
-    std::vector<std::pair<T, int> > m_heap;  // m_heap[]:=(完全二分木). 1-based index.
+    int m_vn;                             // m_vn:=(ノード数).
+    std::vector<std::vector<Edge> > m_g;  // m_g[v][]:=(ノードvがもつ辺のリスト).
+    IndexedHeap<T> m_heap;                // m_heap:=(添字付きヒープ). キーはノードに接続する辺の最小コスト．
     T m_inf;
 
-    void shiht_up(int i) {
-        assert(m_n <= i and i < 2 * m_n);
-        while(i >>= 1) m_heap[i] = std::min(m_heap[2 * i], m_heap[2 * i + 1]);
-    }
-    void push(T cost, int k) {
-        assert(0 <= k and k < m_vn);
-        if(cost >= m_heap[k + m_n].first) return;
-        m_heap[k + m_n] = std::pair<T, int>(cost, k);
-        shiht_up(k + m_n);
-    }
-    void pop() {
-        auto [_, k] = m_heap[1];
-        if(k == -1) return;
-        m_heap[k + m_n] = std::pair<T, int>(m_inf, -1);
-        shiht_up(k + m_n);
-    }
-    std::pair<T, int> top() const { return m_heap[1]; }
-
 public:
     // constructor.
     Prim() : Prim(0) {}
-    explicit Prim(size_t vn, T inf = 1e9) : m_vn(vn), m_g(vn), m_inf(inf) {
-        m_n = 1;
-        while(m_n < m_vn) m_n <<= 1;
-        m_heap.assign(2 * m_n, std::pair<T, int>(m_inf, -1));
-    }
+    explicit Prim(size_t vn, T inf = 1e9) : m_vn(vn), m_g(vn), m_heap(vn), m_inf(inf) {}
 
     // ノード数を返す．
     int size() const { return m_vn; }
@@ -61,17 +38,14 @@ public:
     T prim(int v = 0) {
         assert(0 <= v and v < m_vn);
         T res = 0;
-        bool seen[m_vn] = {};
-        push(0, v);
-        while(1) {
-            auto [cost, u] = top();
-            if(u == -1) break;
-            pop();
-            if(seen[u]) continue;
+        std::vector<bool> seen(m_vn, false);
+        m_heap.push_or_decrease(0, v);
+        while(!m_heap.empty()) {
+            auto [cost, u] = m_heap.pop_min();
             seen[u] = true;
             res += cost;
             for(const Edge &e : m_g[u]) {
-                if(!seen[e.to]) push(e.cost, e.to);
+                if(!seen[e.to]) m_heap.push_or_decrease(e.cost, e.to);
             }
         }
         return res;
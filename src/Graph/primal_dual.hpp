@@ -8,6 +8,8 @@
 #include <utility>     // for pair.
 #include <vector>
 
+#include "../DataStructure/indexed_heap.hpp"
+
 namespace algorithm {
 
 template <typename Flow, typename Cost>  // Flow:容量の型, Cost:コストの型.
@@ -29,6 +31,7 @@ class PrimalDual {
     std::vector<Cost> m_p;                // m_p[v]:=(ノードvのポテンシャル).
     std::vector<int> m_prevv;             // m_prevv[v]:=(ノードvの直前に訪れるノード). 逆方向経路．
     std::vector<int> m_preve;             // m_preve[v]:=(ノードvの直前に通る辺). 逆方向経路．
+    IndexedHeap<Cost> m_heap;             // m_heap:=(添字付きヒープ). dijkstra()で再利用する．
     Cost m_inf;
 
     void init() {
@@ -36,15 +39,11 @@ class PrimalDual {
             for(Edge &e : es) e.cap = e.icap;
         std::fill(m_p.begin(), m_p.end(), 0);
     }
-    void dijkstra(int s) {
+    void dijkstra(int s, bool indexed) {
         std::fill(m_level.begin(), m_level.end(), m_inf);
         m_level[s] = 0;
-        r_priority_queue<std::pair<Cost, int> > pque;
-        pque.emplace(0, s);
-        while(!pque.empty()) {
-            auto [cost, v] = pque.top();
-            pque.pop();
-            if(m_level[v] < cost) continue;
+        // ノードvから辺を緩和する．更新したノードをpush(level,to)で通知する．
+        auto relax = [&](int v, auto push) -> void {
             const int sz = m_g[v].size();
             for(int i = 0; i < sz; ++i) {
                 const Edge &e = m_g[v][i];
@@ -52,9 +51,25 @@ class PrimalDual {
                     m_level[e.to] = m_level[v] + e.cost - m_p[v] + m_p[e.to];
                     m_prevv[e.to] = v;
                     m_preve[e.to] = i;
-                    pque.emplace(m_level[e.to], e.to);
+                    push(m_level[e.to], e.to);
                 }
             }
+        };
+        if(indexed) {
+            m_heap.push_or_decrease(0, s);
+            while(!m_heap.empty()) {
+                int v = m_heap.pop_min().second;
+                relax(v, [&](Cost level, int to) -> void { m_heap.push_or_decrease(level, to); });
+            }
+            return;
+        }
+        r_priority_queue<std::pair<Cost, int> > pque;
+        pque.emplace(0, s);
+        while(!pque.empty()) {
+            auto [cost, v] = pque.top();
+            pque.pop();
+            if(m_level[v] < cost) continue;
+            relax(v, [&](Cost level, int to) -> void { pque.emplace(level, to); });
         }
     }
 
@@ -62,7 +77,7 @@ public:
     // constructor.
     PrimalDual() : PrimalDual(0) {}
     explicit PrimalDual(size_t vn, Cost inf = 1e9)
-        : m_vn(vn), m_g(vn), m_level(vn), m_p(vn), m_prevv(vn), m_preve(vn), m_inf(inf) {}
+        : m_vn(vn), m_g(vn), m_level(vn), m_p(vn), m_prevv(vn), m_preve(vn), m_heap(vn), m_inf(inf) {}
 
     // ノード数を返す．
     int size() const { return m_vn; }
@@ -75,14 +90,15 @@ public:
     }
     // ソースからシンクまでの最小費用（単位コストとフローの積の総和）を求める．
     // 返り値は流量とコスト．O(F*|E|*log|V|).
-    std::pair<Flow, Cost> min_cost_flow(int s, int t, Flow flow) {
+    // indexed=trueの場合，最短路の計算でIndexedHeapを用い，キューの大きさを|V|以下に抑える．
+    std::pair<Flow, Cost> min_cost_flow(int s, int t, Flow flow, bool indexed = false) {
         assert(0 <= s and s < m_vn);
         assert(0 <= t and t < m_vn);
         init();
         Flow rest = flow;
         Cost sum = 0;
         while(rest > 0) {
-            dijkstra(s);
+            dijkstra(s, indexed);
             if(m_level[t] == m_inf) return {flow - rest, sum};  // これ以上流せない場合．
             for(int v = 0; v < m_vn; ++v) m_p[v] -= m_level[v];
             Flow tmp = rest;
@@ -0,0 +1,30 @@
+#ifndef ALGORITHM_PARALLEL_FOR_HPP
+#define ALGORITHM_PARALLEL_FOR_HPP 1
+
+#include <algorithm>  // for max() and min().
+#include <cassert>
+#include <thread>
+#include <vector>
+
+namespace algorithm {
+
+// 区間[0,n)をthread_num個の連続する区間に分割し，各区間[l,r)に対してf(l,r)を並列に呼び出す．
+// 呼び出し元のスレッドも1つの区間を担当する．
+template <class F>
+void parallel_for(int n, int thread_num, const F &f) {
+    assert(n >= 0);
+    assert(thread_num >= 1);
+    thread_num = std::min(thread_num, std::max(n, 1));
+    std::vector<std::thread> threads;
+    threads.reserve(thread_num - 1);
+    for(int i = 1; i < thread_num; ++i) {
+        int l = (long long)n * i / thread_num, r = (long long)n * (i + 1) / thread_num;
+        threads.emplace_back([&f, l, r]() { f(l, r); });
+    }
+    f(0, n / thread_num);
+    for(std::thread &th : threads) th.join();
+}
+
+}  // namespace algorithm
+
+#endif